@@ -0,0 +1,47 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#version 410
+
+layout (location = 0) out vec4 color;
+
+in VS_OUT
+{
+    vec3 position;
+} fs_in;
+
+uniform vec3 u_light_pos = vec3(-100.0, -100.0, 100.0);
+#ifndef MATERIAL_STORAGE
+#define MATERIAL_STORAGE uniform
+#endif
+#ifndef SPECULAR_POWER_STORAGE
+#define SPECULAR_POWER_STORAGE uniform
+#endif
+
+MATERIAL_STORAGE vec3 u_diffuse_albedo = vec3(0.5, 0.2, 0.7);
+MATERIAL_STORAGE vec3 u_specular_albedo = vec3(0.7);
+SPECULAR_POWER_STORAGE float u_specular_power = 128.0;
+
+void main()
+{
+    // The position's screen-space derivatives lie in the triangle's
+    // plane, so their cross product is the face normal.
+    vec3 normal = normalize(cross(dFdx(fs_in.position),
+                                  dFdy(fs_in.position)));
+    vec3 light = normalize(u_light_pos - fs_in.position);
+    vec3 view = normalize(-fs_in.position);
+
+    vec3 diffuse = max(dot(normal, light), 0.0) * u_diffuse_albedo;
+#ifdef NO_SPECULAR
+    color = vec4(diffuse, 1.0);
+#else
+    vec3 ref = reflect(-light, normal);
+    vec3 specular = pow(max(dot(ref, view), 0.0), u_specular_power)
+                    * u_specular_albedo;
+    color = vec4(diffuse + specular, 1.0);
+#endif
+}
@@ -0,0 +1,25 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#version 410
+
+layout (location = 0) in vec3 a_position;
+
+uniform mat4 u_mv_matrix;
+uniform mat4 u_proj_matrix;
+
+out VS_OUT
+{
+    vec3 position;
+} vs_out;
+
+void main()
+{
+    vec4 p = u_mv_matrix * vec4(a_position, 1.0);
+    vs_out.position = p.xyz;
+    gl_Position = u_proj_matrix * p;
+}
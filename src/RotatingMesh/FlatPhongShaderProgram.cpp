@@ -0,0 +1,44 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "FlatPhongShaderProgram.hpp"
+
+#include "FlatPhong-vert.glsl.hpp"
+
+template <typename Variant>
+void FlatPhongShaderProgram<Variant>::setup()
+{
+    program = Tungsten::create_program();
+    auto vertexShader = Tungsten::create_shader(GL_VERTEX_SHADER,
+                                                FlatPhong_vert);
+    Tungsten::attach_shader(program, vertexShader);
+
+    auto fragmentShader = Tungsten::create_shader(
+        GL_FRAGMENT_SHADER, Variant::flat_phong_fragment_shader());
+    Tungsten::attach_shader(program, fragmentShader);
+    Tungsten::link_program(program);
+    Tungsten::use_program(program);
+
+    position_attr = Tungsten::get_vertex_attribute(program, "a_position");
+
+    mv_matrix = Tungsten::get_uniform<Xyz::Matrix4F>(program, "u_mv_matrix");
+    proj_matrix = Tungsten::get_uniform<Xyz::Matrix4F>(program, "u_proj_matrix");
+
+    light_pos = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_light_pos");
+    if constexpr (!Variant::FIXED_MATERIAL)
+    {
+        diffuse_albedo = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_diffuse_albedo");
+        specular_albedo = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_specular_albedo");
+    }
+    if constexpr (!Variant::FIXED_SPECULAR_POWER)
+        specular_power = Tungsten::get_uniform<float>(program, "u_specular_power");
+}
+
+template class FlatPhongShaderProgram<ShaderVariant::Dynamic>;
+template class FlatPhongShaderProgram<ShaderVariant::FixedSpecularPower>;
+template class FlatPhongShaderProgram<ShaderVariant::FixedMaterial>;
+template class FlatPhongShaderProgram<ShaderVariant::Diffuse>;
@@ -0,0 +1,134 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "FrameScheduler.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    constexpr int HIDDEN_WAIT_MS = 250;
+    constexpr std::chrono::seconds REPORT_INTERVAL(60);
+}
+
+FrameScheduler::FrameScheduler(FrameSchedulerSettings settings)
+    : settings_(settings),
+      frame_start_(Clock::now()),
+      period_start_(frame_start_),
+      period_cpu_start_(std::clock())
+{}
+
+void FrameScheduler::set_vsync(bool vsync)
+{
+    vsync_ = vsync;
+}
+
+void FrameScheduler::handle_window_event(const SDL_WindowEvent& event)
+{
+    switch (event.event)
+    {
+    case SDL_WINDOWEVENT_HIDDEN:
+    case SDL_WINDOWEVENT_MINIMIZED:
+        visible_ = false;
+        break;
+    case SDL_WINDOWEVENT_SHOWN:
+    case SDL_WINDOWEVENT_EXPOSED:
+    case SDL_WINDOWEVENT_RESTORED:
+    case SDL_WINDOWEVENT_MAXIMIZED:
+        visible_ = true;
+        break;
+    case SDL_WINDOWEVENT_FOCUS_GAINED:
+        focused_ = true;
+        break;
+    case SDL_WINDOWEVENT_FOCUS_LOST:
+        focused_ = false;
+        break;
+    default:
+        break;
+    }
+}
+
+bool FrameScheduler::is_visible() const
+{
+    return visible_;
+}
+
+void FrameScheduler::begin_frame()
+{
+    if (!visible_)
+    {
+        SDL_WaitEventTimeout(nullptr, HIDDEN_WAIT_MS);
+        frame_start_ = Clock::now();
+        return;
+    }
+
+    auto next_start = frame_start_ + frame_interval();
+    auto now = Clock::now();
+    if (next_start > now)
+    {
+        std::this_thread::sleep_until(next_start);
+        now = Clock::now();
+    }
+    frame_start_ = now;
+}
+
+void FrameScheduler::end_frame(bool drawn)
+{
+    if (drawn)
+        ++drawn_frames_;
+    else
+        ++skipped_frames_;
+
+    auto now = Clock::now();
+    if (now - period_start_ >= REPORT_INTERVAL)
+        report(now);
+}
+
+std::atomic<uint64_t>& FrameScheduler::gpu_nanoseconds()
+{
+    return gpu_nanoseconds_;
+}
+
+FrameScheduler::Clock::duration FrameScheduler::frame_interval() const
+{
+    unsigned fps = 0;
+    if (!focused_)
+        fps = settings_.unfocused_fps;
+    else if (!vsync_)
+        fps = settings_.max_fps;
+
+    if (fps == 0)
+        return Clock::duration::zero();
+    return std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / fps));
+}
+
+void FrameScheduler::report(Clock::time_point now)
+{
+    auto cpu_now = std::clock();
+    std::chrono::duration<double> wall = now - period_start_;
+    auto cpu = double(cpu_now - period_cpu_start_) / CLOCKS_PER_SEC;
+    auto gpu = double(gpu_nanoseconds_.exchange(0)) * 1e-9;
+
+    if (settings_.report)
+    {
+        std::cout << std::fixed << std::setprecision(2)
+                  << "busy time over " << wall.count() << " s: "
+                  << drawn_frames_ << " frames drawn, "
+                  << skipped_frames_ << " skipped, cpu "
+                  << cpu << " s (" << 100 * cpu / wall.count() << "%), gpu "
+                  << gpu << " s (" << 100 * gpu / wall.count() << "%)"
+                  << std::endl;
+    }
+
+    period_start_ = now;
+    period_cpu_start_ = cpu_now;
+    drawn_frames_ = 0;
+    skipped_frames_ = 0;
+}
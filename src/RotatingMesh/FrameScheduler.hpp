@@ -0,0 +1,84 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <Tungsten/Tungsten.hpp>
+
+struct FrameSchedulerSettings
+{
+    /// The frame rate while the window doesn't have input focus.
+    unsigned unfocused_fps = 10;
+    /// The frame rate limit when vsync isn't available.
+    unsigned max_fps = 60;
+    /// Print CPU and GPU busy time every minute.
+    bool report = false;
+};
+
+/**
+ * @brief Decides when and whether the loop should draw, based on the
+ *  window's visibility and focus.
+ *
+ * Nothing is drawn while the window is hidden or minimized, and the
+ * frame rate is lowered while the window is unfocused. Without vsync
+ * the frame rate is capped at max_fps.
+ */
+class FrameScheduler
+{
+public:
+    explicit FrameScheduler(FrameSchedulerSettings settings = {});
+
+    /**
+     * @brief Tells the scheduler whether buffer swaps wait for vsync.
+     */
+    void set_vsync(bool vsync);
+
+    void handle_window_event(const SDL_WindowEvent& event);
+
+    [[nodiscard]]
+    bool is_visible() const;
+
+    /**
+     * @brief Waits until it is time to start the next frame.
+     *
+     * While the window is hidden this returns after at most a quarter
+     * of a second, or as soon as there is an event to process.
+     */
+    void begin_frame();
+
+    /**
+     * @brief Counts the frame and prints the busy-time report when a
+     *  minute has passed.
+     */
+    void end_frame(bool drawn);
+
+    /**
+     * @brief The GPU time to include in the report, see GpuTimer.
+     */
+    std::atomic<uint64_t>& gpu_nanoseconds();
+private:
+    using Clock = std::chrono::steady_clock;
+
+    [[nodiscard]]
+    Clock::duration frame_interval() const;
+
+    void report(Clock::time_point now);
+
+    FrameSchedulerSettings settings_;
+    bool vsync_ = true;
+    bool visible_ = true;
+    bool focused_ = true;
+    Clock::time_point frame_start_;
+
+    Clock::time_point period_start_;
+    std::clock_t period_cpu_start_;
+    std::atomic<uint64_t> gpu_nanoseconds_ = 0;
+    uint64_t drawn_frames_ = 0;
+    uint64_t skipped_frames_ = 0;
+};
@@ -0,0 +1,75 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "FrameTimes.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+
+namespace
+{
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    void write_distribution(std::ostream& stream, const char* name,
+                            std::vector<double> durations)
+    {
+        stream << name << " (" << durations.size() << " samples):\n";
+        if (durations.empty())
+            return;
+
+        std::sort(durations.begin(), durations.end());
+        auto percentile = [&](double p)
+        {
+            auto index = size_t(p / 100.0 * double(durations.size() - 1) + 0.5);
+            return durations[index];
+        };
+        auto mean = std::accumulate(durations.begin(), durations.end(), 0.0)
+                    / double(durations.size());
+
+        stream << std::fixed << std::setprecision(3)
+               << "  mean: " << mean << " ms\n"
+               << "  min: " << durations.front() << " ms\n";
+        for (double p : {50.0, 90.0, 95.0, 99.0})
+            stream << "  p" << int(p) << ": " << percentile(p) << " ms\n";
+        stream << "  max: " << durations.back() << " ms\n";
+    }
+}
+
+void FrameTimes::begin_frame()
+{
+    auto now = Clock::now();
+    if (started_)
+        intervals_.push_back(Milliseconds(now - frame_start_).count());
+    frame_start_ = now;
+    started_ = true;
+}
+
+void FrameTimes::end_frame()
+{
+    if (started_)
+        cpu_times_.push_back(Milliseconds(Clock::now() - frame_start_).count());
+}
+
+void FrameTimes::add_gpu_time(double milliseconds)
+{
+    gpu_times_.push_back(milliseconds);
+}
+
+size_t FrameTimes::size() const
+{
+    return cpu_times_.size();
+}
+
+void FrameTimes::write_report(std::ostream& stream) const
+{
+    stream << "frames: " << size() << "\n";
+    write_distribution(stream, "frame interval", intervals_);
+    write_distribution(stream, "cpu", cpu_times_);
+    write_distribution(stream, "gpu", gpu_times_);
+}
@@ -0,0 +1,53 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <chrono>
+#include <iosfwd>
+#include <vector>
+
+/**
+ * @brief Collects per-frame timings and reports their distributions.
+ *
+ * Three times are recorded for each frame: the wall-clock interval
+ * since the previous frame, the time the main thread spends working
+ * on the frame (excluding the buffer swap) and the GPU time reported
+ * by GpuTimer.
+ */
+class FrameTimes
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Records the time since the previous call and starts
+     *  timing the frame's CPU work.
+     */
+    void begin_frame();
+
+    /**
+     * @brief Records the time since begin_frame().
+     */
+    void end_frame();
+
+    void add_gpu_time(double milliseconds);
+
+    [[nodiscard]]
+    size_t size() const;
+
+    /**
+     * @brief Writes the number of frames, and the mean and a selection
+     *  of percentiles in milliseconds for each kind of time.
+     */
+    void write_report(std::ostream& stream) const;
+private:
+    std::vector<double> intervals_;
+    std::vector<double> cpu_times_;
+    std::vector<double> gpu_times_;
+    Clock::time_point frame_start_;
+    bool started_ = false;
+};
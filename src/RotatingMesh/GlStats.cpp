@@ -0,0 +1,247 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "GlStats.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace GlStats
+{
+    namespace
+    {
+        struct Counters
+        {
+            std::atomic<uint64_t> gl_calls = 0;
+            std::atomic<uint64_t> draw_calls = 0;
+            std::atomic<uint64_t> elements = 0;
+            std::atomic<uint64_t> buffer_uploads = 0;
+            std::atomic<uint64_t> buffer_bytes = 0;
+            std::atomic<uint64_t> uniform_sets = 0;
+            std::atomic<uint64_t> redundant_uniform_sets = 0;
+            std::atomic<uint64_t> state_changes = 0;
+            std::atomic<uint64_t> redundant_state_changes = 0;
+        };
+
+        Counters COUNTERS;
+
+        void increment(std::atomic<uint64_t>& counter, uint64_t value = 1)
+        {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        uint64_t take(std::atomic<uint64_t>& counter)
+        {
+            return counter.exchange(0, std::memory_order_relaxed);
+        }
+
+        // The cached state is only touched by the thread that owns the
+        // GL context.
+        GLuint current_program = 0;
+        GLenum current_polygon_mode = 0;
+        std::unordered_map<const void*, std::vector<char>> uniform_values;
+
+        using Clock = std::chrono::steady_clock;
+
+        constexpr size_t WINDOW_SIZE = 120;
+
+        struct Window
+        {
+            std::array<FrameStats, WINDOW_SIZE> frames;
+            std::array<Clock::time_point, WINDOW_SIZE> times;
+            size_t next = 0;
+            size_t size = 0;
+        };
+
+        Window WINDOW;
+
+        void accumulate(FrameStats& sum, FrameStats& peak,
+                        const FrameStats& frame)
+        {
+            #define GLSTATS_ACCUMULATE(member) \
+                sum.member += frame.member; \
+                peak.member = std::max(peak.member, frame.member)
+
+            GLSTATS_ACCUMULATE(gl_calls);
+            GLSTATS_ACCUMULATE(draw_calls);
+            GLSTATS_ACCUMULATE(elements);
+            GLSTATS_ACCUMULATE(buffer_uploads);
+            GLSTATS_ACCUMULATE(buffer_bytes);
+            GLSTATS_ACCUMULATE(uniform_sets);
+            GLSTATS_ACCUMULATE(redundant_uniform_sets);
+            GLSTATS_ACCUMULATE(state_changes);
+            GLSTATS_ACCUMULATE(redundant_state_changes);
+
+            #undef GLSTATS_ACCUMULATE
+        }
+
+        void divide(FrameStats& stats, uint64_t n)
+        {
+            auto round = [n](uint64_t value) {return (value + n / 2) / n;};
+            stats.gl_calls = round(stats.gl_calls);
+            stats.draw_calls = round(stats.draw_calls);
+            stats.elements = round(stats.elements);
+            stats.buffer_uploads = round(stats.buffer_uploads);
+            stats.buffer_bytes = round(stats.buffer_bytes);
+            stats.uniform_sets = round(stats.uniform_sets);
+            stats.redundant_uniform_sets = round(stats.redundant_uniform_sets);
+            stats.state_changes = round(stats.state_changes);
+            stats.redundant_state_changes = round(stats.redundant_state_changes);
+        }
+    }
+
+    void set_buffer_subdata(GLenum target, GLintptr offset,
+                            GLsizeiptr size, const void* data)
+    {
+        increment(COUNTERS.gl_calls);
+        increment(COUNTERS.buffer_uploads);
+        increment(COUNTERS.buffer_bytes, uint64_t(size));
+        Tungsten::set_buffer_subdata(target, offset, size, data);
+    }
+
+    void draw_elements(GLenum mode, GLsizei count, GLenum type,
+                       const void* indices)
+    {
+        increment(COUNTERS.gl_calls);
+        increment(COUNTERS.draw_calls);
+        increment(COUNTERS.elements, uint64_t(count));
+        glDrawElements(mode, count, type, indices);
+    }
+
+    void multi_draw_elements_base_vertex(GLenum mode, const GLsizei* counts,
+                                         GLenum type,
+                                         const void* const* indices,
+                                         GLsizei draw_count,
+                                         const GLint* base_vertexes)
+    {
+        increment(COUNTERS.gl_calls);
+        increment(COUNTERS.draw_calls);
+        uint64_t elements = 0;
+        for (GLsizei i = 0; i < draw_count; ++i)
+            elements += uint64_t(counts[i]);
+        increment(COUNTERS.elements, elements);
+        glMultiDrawElementsBaseVertex(mode, counts, type, indices, draw_count,
+                                      base_vertexes);
+    }
+
+    void use_program(const Tungsten::ProgramHandle& program)
+    {
+        increment(COUNTERS.gl_calls);
+        increment(COUNTERS.state_changes);
+        if (program.get() == current_program)
+            increment(COUNTERS.redundant_state_changes);
+        current_program = program.get();
+        Tungsten::use_program(program);
+    }
+
+    void polygon_mode(GLenum face, GLenum mode)
+    {
+        increment(COUNTERS.gl_calls);
+        increment(COUNTERS.state_changes);
+        if (face == GL_FRONT_AND_BACK && mode == current_polygon_mode)
+            increment(COUNTERS.redundant_state_changes);
+        current_polygon_mode = face == GL_FRONT_AND_BACK ? mode : 0;
+        glPolygonMode(face, mode);
+    }
+
+    bool is_redundant_uniform(const void* uniform,
+                              const void* value, size_t size)
+    {
+        auto bytes = static_cast<const char*>(value);
+        auto& prev = uniform_values[uniform];
+        if (prev.size() == size && std::memcmp(prev.data(), bytes, size) == 0)
+            return true;
+        prev.assign(bytes, bytes + size);
+        return false;
+    }
+
+    void count_uniform_set(bool redundant)
+    {
+        increment(COUNTERS.gl_calls);
+        increment(COUNTERS.uniform_sets);
+        if (redundant)
+            increment(COUNTERS.redundant_uniform_sets);
+    }
+
+    void invalidate_state()
+    {
+        current_program = 0;
+        current_polygon_mode = 0;
+    }
+
+    void end_frame()
+    {
+        FrameStats frame;
+        frame.gl_calls = take(COUNTERS.gl_calls);
+        frame.draw_calls = take(COUNTERS.draw_calls);
+        frame.elements = take(COUNTERS.elements);
+        frame.buffer_uploads = take(COUNTERS.buffer_uploads);
+        frame.buffer_bytes = take(COUNTERS.buffer_bytes);
+        frame.uniform_sets = take(COUNTERS.uniform_sets);
+        frame.redundant_uniform_sets = take(COUNTERS.redundant_uniform_sets);
+        frame.state_changes = take(COUNTERS.state_changes);
+        frame.redundant_state_changes = take(COUNTERS.redundant_state_changes);
+
+        WINDOW.frames[WINDOW.next] = frame;
+        WINDOW.times[WINDOW.next] = Clock::now();
+        WINDOW.next = (WINDOW.next + 1) % WINDOW_SIZE;
+        WINDOW.size = std::min(WINDOW.size + 1, WINDOW_SIZE);
+    }
+
+    Summary summary()
+    {
+        Summary result;
+        result.frames = WINDOW.size;
+        if (WINDOW.size == 0)
+            return result;
+
+        for (size_t i = 0; i < WINDOW.size; ++i)
+            accumulate(result.average, result.peak, WINDOW.frames[i]);
+        divide(result.average, WINDOW.size);
+
+        auto last = (WINDOW.next + WINDOW_SIZE - 1) % WINDOW_SIZE;
+        auto first = (WINDOW.next + WINDOW_SIZE - WINDOW.size) % WINDOW_SIZE;
+        std::chrono::duration<double> elapsed = WINDOW.times[last]
+                                                - WINDOW.times[first];
+        if (elapsed.count() > 0)
+            result.fps = double(WINDOW.size - 1) / elapsed.count();
+        return result;
+    }
+
+    void write_summary(std::ostream& stream, const Summary& summary)
+    {
+        const auto& avg = summary.average;
+        const auto& peak = summary.peak;
+        stream << std::fixed << std::setprecision(1)
+               << "frames " << summary.frames
+               << "  fps " << summary.fps << "\n"
+               << "gl calls " << avg.gl_calls << "/f (max " << peak.gl_calls
+               << ")  draws " << avg.draw_calls
+               << "  elements " << avg.elements << "\n"
+               << "uploads " << avg.buffer_uploads
+               << "  bytes " << avg.buffer_bytes
+               << "/f (max " << peak.buffer_bytes << ")\n"
+               << "state changes " << avg.state_changes
+               << "  redundant " << avg.redundant_state_changes << "\n"
+               << "uniform sets " << avg.uniform_sets
+               << "  redundant " << avg.redundant_uniform_sets << "\n";
+    }
+
+    std::string format_summary(const Summary& summary)
+    {
+        std::ostringstream ss;
+        write_summary(ss, summary);
+        return ss.str();
+    }
+}
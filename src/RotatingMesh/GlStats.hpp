@@ -0,0 +1,96 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <Tungsten/Tungsten.hpp>
+
+/**
+ * @brief Counting wrappers around the GL calls the application makes.
+ *
+ * The counters are atomics, so they can be incremented from whichever
+ * thread owns the GL context without locks. end_frame() moves the
+ * current counts into a rolling window that summary() reports on.
+ */
+namespace GlStats
+{
+    struct FrameStats
+    {
+        uint64_t gl_calls = 0;
+        uint64_t draw_calls = 0;
+        uint64_t elements = 0;
+        uint64_t buffer_uploads = 0;
+        uint64_t buffer_bytes = 0;
+        uint64_t uniform_sets = 0;
+        uint64_t redundant_uniform_sets = 0;
+        uint64_t state_changes = 0;
+        uint64_t redundant_state_changes = 0;
+    };
+
+    struct Summary
+    {
+        /// The number of frames in the rolling window.
+        size_t frames = 0;
+        /// Frames per second over the rolling window.
+        double fps = 0;
+        /// Per-frame averages over the rolling window.
+        FrameStats average;
+        /// Per-counter maximums over the rolling window.
+        FrameStats peak;
+    };
+
+    void set_buffer_subdata(GLenum target, GLintptr offset,
+                            GLsizeiptr size, const void* data);
+
+    void draw_elements(GLenum mode, GLsizei count, GLenum type,
+                       const void* indices);
+
+    void multi_draw_elements_base_vertex(GLenum mode, const GLsizei* counts,
+                                         GLenum type,
+                                         const void* const* indices,
+                                         GLsizei draw_count,
+                                         const GLint* base_vertexes);
+
+    void use_program(const Tungsten::ProgramHandle& program);
+
+    void polygon_mode(GLenum face, GLenum mode);
+
+    /**
+     * @brief Returns true if @a value is identical to the last value
+     *  passed with the same @a uniform, and remembers @a value otherwise.
+     */
+    bool is_redundant_uniform(const void* uniform,
+                              const void* value, size_t size);
+
+    void count_uniform_set(bool redundant);
+
+    template <typename T>
+    void set_uniform(Tungsten::Uniform<T>& uniform, const T& value)
+    {
+        bool redundant = is_redundant_uniform(&uniform, &value, sizeof(T));
+        count_uniform_set(redundant);
+        uniform.set(value);
+    }
+
+    /**
+     * @brief Forget the cached GL state, e.g. after code that isn't
+     *  instrumented has changed the current program or polygon mode.
+     */
+    void invalidate_state();
+
+    void end_frame();
+
+    [[nodiscard]]
+    Summary summary();
+
+    void write_summary(std::ostream& stream, const Summary& summary);
+
+    [[nodiscard]]
+    std::string format_summary(const Summary& summary);
+}
@@ -0,0 +1,48 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "GlStatsReporter.hpp"
+
+#include <stdexcept>
+#include "GlStats.hpp"
+
+void GlStatsReporter::setup(const std::string& file_name)
+{
+    text_overlay_.setup();
+
+    if (!file_name.empty())
+    {
+        file_.open(file_name, std::ios::app);
+        if (!file_)
+            throw std::runtime_error("Unable to open " + file_name);
+    }
+}
+
+void GlStatsReporter::report(bool show_overlay)
+{
+    GlStats::end_frame();
+
+    auto ticks = SDL_GetTicks();
+    if (show_overlay)
+    {
+        if (ticks - overlay_timestamp_ >= OVERLAY_INTERVAL)
+        {
+            overlay_timestamp_ = ticks;
+            text_overlay_.set_text(
+                GlStats::format_summary(GlStats::summary()));
+        }
+        text_overlay_.draw();
+    }
+
+    if (file_ && ticks - file_timestamp_ >= FILE_INTERVAL)
+    {
+        file_timestamp_ = ticks;
+        file_ << "[" << ticks << " ms]\n";
+        GlStats::write_summary(file_, GlStats::summary());
+        file_.flush();
+    }
+}
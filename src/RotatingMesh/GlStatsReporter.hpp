@@ -0,0 +1,41 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <fstream>
+#include "TextOverlay.hpp"
+
+/**
+ * @brief Shows the GlStats summary in a TextOverlay and appends it
+ *  to a file at regular intervals.
+ *
+ * Must be used by the thread that owns the GL context.
+ */
+class GlStatsReporter
+{
+public:
+    /**
+     * @brief Creates the overlay, and opens @a file_name if it isn't
+     *  empty.
+     *
+     * @throw std::runtime_error if the file can't be opened.
+     */
+    void setup(const std::string& file_name);
+
+    /**
+     * @brief Ends the current GlStats frame and reports the summary.
+     */
+    void report(bool show_overlay);
+private:
+    static constexpr uint32_t OVERLAY_INTERVAL = 500;
+    static constexpr uint32_t FILE_INTERVAL = 5000;
+
+    TextOverlay text_overlay_;
+    uint32_t overlay_timestamp_ = 0;
+    std::ofstream file_;
+    uint32_t file_timestamp_ = 0;
+};
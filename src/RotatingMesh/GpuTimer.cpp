@@ -0,0 +1,65 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "GpuTimer.hpp"
+
+#include <utility>
+
+GpuTimer::GpuTimer(std::atomic<uint64_t>& nanoseconds,
+                   std::function<void(uint64_t)> on_sample)
+    : nanoseconds_(nanoseconds),
+      on_sample_(std::move(on_sample))
+{
+    glGenQueries(GLsizei(QUERY_COUNT), queries_.data());
+}
+
+GpuTimer::~GpuTimer()
+{
+    glDeleteQueries(GLsizei(QUERY_COUNT), queries_.data());
+}
+
+void GpuTimer::begin()
+{
+    collect();
+    if (pending_[next_])
+        return;
+
+    glBeginQuery(GL_TIME_ELAPSED, queries_[next_]);
+    active_ = true;
+}
+
+void GpuTimer::end()
+{
+    if (!active_)
+        return;
+
+    glEndQuery(GL_TIME_ELAPSED);
+    pending_[next_] = true;
+    next_ = (next_ + 1) % QUERY_COUNT;
+    active_ = false;
+}
+
+void GpuTimer::collect()
+{
+    for (size_t i = 0; i < QUERY_COUNT; ++i)
+    {
+        if (!pending_[i])
+            continue;
+
+        GLint available = 0;
+        glGetQueryObjectiv(queries_[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            continue;
+
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(queries_[i], GL_QUERY_RESULT, &elapsed);
+        nanoseconds_.fetch_add(elapsed, std::memory_order_relaxed);
+        if (on_sample_)
+            on_sample_(elapsed);
+        pending_[i] = false;
+    }
+}
@@ -0,0 +1,78 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <array>
+#include <atomic>
+#include <functional>
+#include <Tungsten/Tungsten.hpp>
+
+/**
+ * @brief Measures GPU time with GL_TIME_ELAPSED queries and adds it
+ *  to a counter that other threads can read.
+ *
+ * Results are collected when they become available, a few frames
+ * later, so the timer never stalls the pipeline. A frame isn't timed
+ * if all queries are still pending. Must be created, used and
+ * destroyed by the thread that owns the GL context.
+ */
+class GpuTimer
+{
+public:
+    /**
+     * @param on_sample If set, is called with the nanoseconds of each
+     *  timed frame as the results are collected.
+     */
+    explicit GpuTimer(std::atomic<uint64_t>& nanoseconds,
+                      std::function<void(uint64_t)> on_sample = {});
+
+    ~GpuTimer();
+
+    GpuTimer(const GpuTimer&) = delete;
+
+    GpuTimer& operator=(const GpuTimer&) = delete;
+
+    void begin();
+
+    void end();
+private:
+    void collect();
+
+    static constexpr size_t QUERY_COUNT = 4;
+
+    std::atomic<uint64_t>& nanoseconds_;
+    std::function<void(uint64_t)> on_sample_;
+    std::array<GLuint, QUERY_COUNT> queries_ = {};
+    std::array<bool, QUERY_COUNT> pending_ = {};
+    size_t next_ = 0;
+    bool active_ = false;
+};
+
+/**
+ * @brief Times the GPU commands issued during its lifetime, also when
+ *  they are interrupted by an exception.
+ */
+class GpuTimerScope
+{
+public:
+    explicit GpuTimerScope(GpuTimer& timer)
+        : timer_(timer)
+    {
+        timer_.begin();
+    }
+
+    ~GpuTimerScope()
+    {
+        timer_.end();
+    }
+
+    GpuTimerScope(const GpuTimerScope&) = delete;
+
+    GpuTimerScope& operator=(const GpuTimerScope&) = delete;
+private:
+    GpuTimer& timer_;
+};
@@ -0,0 +1,122 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "InputRecording.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace
+{
+    constexpr char MAGIC[4] = {'R', 'M', 'I', 'R'};
+    constexpr uint32_t VERSION = 1;
+
+    enum RecordType : uint8_t
+    {
+        FRAME_RECORD = 1,
+        KEY_RECORD = 2
+    };
+
+    void write_u8(std::ostream& stream, uint8_t value)
+    {
+        stream.put(char(value));
+    }
+
+    void write_u32(std::ostream& stream, uint32_t value)
+    {
+        char bytes[4];
+        for (int i = 0; i < 4; ++i)
+            bytes[i] = char((value >> (8 * i)) & 0xFFu);
+        stream.write(bytes, 4);
+    }
+
+    uint8_t read_u8(std::istream& stream)
+    {
+        auto c = stream.get();
+        if (c == std::char_traits<char>::eof())
+            throw std::runtime_error("Input recording is truncated.");
+        return uint8_t(c);
+    }
+
+    uint32_t read_u32(std::istream& stream)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i)
+            value |= uint32_t(read_u8(stream)) << (8 * i);
+        return value;
+    }
+}
+
+InputRecorder::InputRecorder(const std::string& path)
+    : file_(path, std::ios::binary)
+{
+    if (!file_)
+        throw std::runtime_error("Unable to create " + path);
+    file_.write(MAGIC, sizeof(MAGIC));
+    write_u32(file_, VERSION);
+}
+
+void InputRecorder::record_key(const SDL_KeyboardEvent& event)
+{
+    write_u8(file_, KEY_RECORD);
+    write_u32(file_, event.timestamp);
+    write_u8(file_, event.type == SDL_KEYDOWN ? 0 : 1);
+    write_u8(file_, event.repeat);
+    write_u32(file_, uint32_t(event.keysym.sym));
+}
+
+void InputRecorder::record_frame(uint32_t timestamp)
+{
+    write_u8(file_, FRAME_RECORD);
+    write_u32(file_, timestamp);
+}
+
+InputPlayer::InputPlayer(const std::string& path)
+    : file_(path, std::ios::binary)
+{
+    if (!file_)
+        throw std::runtime_error("Unable to open " + path);
+
+    char magic[sizeof(MAGIC)] = {};
+    file_.read(magic, sizeof(magic));
+    if (!std::equal(std::begin(magic), std::end(magic), MAGIC))
+        throw std::runtime_error(path + " is not an input recording.");
+    if (read_u32(file_) != VERSION)
+        throw std::runtime_error(path + ": unsupported version.");
+}
+
+bool InputPlayer::read_frame(uint32_t& timestamp,
+                             std::vector<SDL_Event>& events)
+{
+    events.clear();
+    while (true)
+    {
+        auto type = file_.get();
+        if (type == std::char_traits<char>::eof())
+            return false;
+
+        if (type == FRAME_RECORD)
+        {
+            timestamp = read_u32(file_);
+            return true;
+        }
+
+        if (type != KEY_RECORD)
+            throw std::runtime_error("Input recording is corrupt.");
+
+        SDL_Event event = {};
+        event.key.timestamp = read_u32(file_);
+        event.type = read_u8(file_) == 0 ? SDL_KEYDOWN : SDL_KEYUP;
+        event.key.type = event.type;
+        event.key.state = event.type == SDL_KEYDOWN ? SDL_PRESSED
+                                                    : SDL_RELEASED;
+        event.key.repeat = read_u8(file_);
+        event.key.keysym.sym = SDL_Keycode(read_u32(file_));
+        events.push_back(event);
+    }
+}
@@ -0,0 +1,56 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <fstream>
+#include <string>
+#include <vector>
+#include <Tungsten/Tungsten.hpp>
+
+/**
+ * @brief Writes key events and frame timestamps to a binary file.
+ *
+ * The file starts with the magic "RMIR" and a 32-bit version number,
+ * followed by a sequence of records. Each record starts with a type
+ * byte:
+ *  - 1 (frame): 32-bit timestamp.
+ *  - 2 (key): 32-bit timestamp, 8-bit event type (0 = down, 1 = up),
+ *    8-bit repeat count, 32-bit key code.
+ *
+ * All integers are little-endian. The key events that arrive before a
+ * frame are written before that frame's record.
+ */
+class InputRecorder
+{
+public:
+    explicit InputRecorder(const std::string& path);
+
+    void record_key(const SDL_KeyboardEvent& event);
+
+    void record_frame(uint32_t timestamp);
+private:
+    std::ofstream file_;
+};
+
+/**
+ * @brief Reads files written by InputRecorder.
+ */
+class InputPlayer
+{
+public:
+    explicit InputPlayer(const std::string& path);
+
+    /**
+     * @brief Reads the next frame's timestamp and the key events that
+     *  preceded it.
+     *
+     * @return false if there are no more frames.
+     */
+    bool read_frame(uint32_t& timestamp, std::vector<SDL_Event>& events);
+private:
+    std::ifstream file_;
+};
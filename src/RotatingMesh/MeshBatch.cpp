@@ -0,0 +1,310 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "MeshBatch.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include "GlStats.hpp"
+
+namespace
+{
+    constexpr size_t INITIAL_CAPACITY = 4096;
+
+    // The shader reads each matrix as four rows.
+    static_assert(sizeof(Xyz::Matrix4F) == 16 * sizeof(float));
+
+    Tungsten::BufferHandle make_buffer(GLenum target, size_t size)
+    {
+        auto buffers = Tungsten::generate_buffers(1);
+        glBindBuffer(target, buffers[0].get());
+        glBufferData(target, GLsizeiptr(size), nullptr, GL_DYNAMIC_DRAW);
+        return std::move(buffers[0]);
+    }
+
+    /**
+     * @brief Replaces @a buffer with a larger buffer that starts with
+     *  the first @a old_size bytes of @a buffer.
+     *
+     * The new buffer is left bound to @a target.
+     */
+    void grow_buffer(Tungsten::BufferHandle& buffer, GLenum target,
+                     size_t old_size, size_t new_size)
+    {
+        auto new_buffer = make_buffer(target, new_size);
+        if (old_size != 0)
+        {
+            glBindBuffer(GL_COPY_READ_BUFFER, buffer.get());
+            glBindBuffer(GL_COPY_WRITE_BUFFER, new_buffer.get());
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                                0, 0, GLsizeiptr(old_size));
+        }
+        buffer = std::move(new_buffer);
+        glBindBuffer(target, buffer.get());
+    }
+
+    template <typename Span>
+    void add_to_span(Span& span, size_t first, size_t count)
+    {
+        if (span.begin >= span.end)
+        {
+            span = {first, first + count};
+            return;
+        }
+        span.begin = std::min(span.begin, first);
+        span.end = std::max(span.end, first + count);
+    }
+
+    template <typename T, typename Span>
+    void upload_span(GLenum target, const std::vector<T>& data, Span& span)
+    {
+        if (span.begin >= span.end)
+            return;
+        GlStats::set_buffer_subdata(
+            target,
+            GLintptr(span.begin * sizeof(T)),
+            GLsizeiptr((span.end - span.begin) * sizeof(T)),
+            data.data() + span.begin);
+        span = {};
+    }
+
+    size_t grown_capacity(size_t capacity, size_t required)
+    {
+        capacity = std::max(capacity, INITIAL_CAPACITY);
+        while (capacity < required)
+            capacity *= 2;
+        return capacity;
+    }
+}
+
+void MeshBatch::setup(const SceneShaderProgram<ShaderVariant::Active>& program)
+{
+    position_attr_ = program.position_attr;
+    normal_attr_ = program.normal_attr;
+    object_index_attr_ = program.object_index_attr;
+
+    vertex_array_ = Tungsten::generate_vertex_array();
+    reserve(INITIAL_CAPACITY, INITIAL_CAPACITY);
+
+    transform_buffer_ = make_buffer(GL_TEXTURE_BUFFER, 0);
+    transform_texture_ = Tungsten::generate_texture();
+    // The texture keeps referring to the buffer when draw() reallocates
+    // its storage.
+    glBindTexture(GL_TEXTURE_BUFFER, transform_texture_.get());
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, transform_buffer_.get());
+}
+
+size_t MeshBatch::add_object()
+{
+    size_t object;
+    if (!free_objects_.empty())
+    {
+        object = free_objects_.back();
+        free_objects_.pop_back();
+        objects_[object] = {};
+    }
+    else
+    {
+        object = objects_.size();
+        objects_.emplace_back();
+        transforms_.emplace_back();
+    }
+    objects_[object].active = true;
+    update_commands_ = true;
+    return object;
+}
+
+void MeshBatch::remove_object(size_t object)
+{
+    auto& obj = objects_.at(object);
+    if (!obj.active)
+        return;
+    vertex_allocator_.free(obj.first_vertex, obj.vertex_count);
+    index_allocator_.free(obj.first_index, obj.index_count);
+    obj = {};
+    free_objects_.push_back(object);
+    update_commands_ = true;
+}
+
+size_t MeshBatch::object_count() const
+{
+    return objects_.size() - free_objects_.size();
+}
+
+void MeshBatch::set_mesh(size_t object, const Xyz::Mesh<float>& mesh)
+{
+    auto& obj = objects_.at(object);
+    const auto& faces = mesh.faces();
+    const auto& vertexes = mesh.vertexes();
+    auto vertex_count = faces.size() * 3;
+    if (vertex_count > std::numeric_limits<uint16_t>::max())
+        throw std::runtime_error("MeshBatch: the mesh is too large.");
+
+    if (vertex_count != obj.vertex_count)
+    {
+        vertex_allocator_.free(obj.first_vertex, obj.vertex_count);
+        index_allocator_.free(obj.first_index, obj.index_count);
+        obj.vertex_count = obj.index_count = 0;
+
+        auto first_vertex = vertex_allocator_.allocate(vertex_count);
+        auto first_index = index_allocator_.allocate(vertex_count);
+        if (!first_vertex || !first_index)
+        {
+            if (first_vertex)
+                vertex_allocator_.free(*first_vertex, vertex_count);
+            if (first_index)
+                index_allocator_.free(*first_index, vertex_count);
+            reserve(vertex_allocator_.capacity() + vertex_count,
+                    index_allocator_.capacity() + vertex_count);
+            first_vertex = vertex_allocator_.allocate(vertex_count);
+            first_index = index_allocator_.allocate(vertex_count);
+        }
+
+        obj.first_vertex = *first_vertex;
+        obj.vertex_count = vertex_count;
+        obj.first_index = *first_index;
+        obj.index_count = vertex_count;
+        update_commands_ = true;
+
+        // Each face has its own vertexes, so the indexes only depend
+        // on the number of faces.
+        for (size_t i = 0; i < vertex_count; ++i)
+            index_data_[obj.first_index + i] = uint16_t(i);
+        add_to_span(changed_indexes_, obj.first_index, vertex_count);
+    }
+
+    auto* vertex = vertex_data_.data() + obj.first_vertex;
+    auto object_index = float(object);
+    for (const auto& face : faces)
+    {
+        auto normal = mesh.normal(face);
+        for (auto i : face)
+            *vertex++ = {vertexes[i], normal, object_index};
+    }
+    add_to_span(changed_vertexes_, obj.first_vertex, vertex_count);
+}
+
+void MeshBatch::set_transform(size_t object, const Xyz::Matrix4F& transform)
+{
+    transforms_.at(object) = transform;
+}
+
+void MeshBatch::draw()
+{
+    if (update_commands_)
+        update_draw_commands();
+    if (counts_.empty())
+        return;
+
+    glBindBuffer(GL_TEXTURE_BUFFER, transform_buffer_.get());
+    if (transform_capacity_ < transforms_.size())
+    {
+        transform_capacity_ = grown_capacity(transform_capacity_,
+                                             transforms_.size());
+        glBufferData(GL_TEXTURE_BUFFER,
+                     GLsizeiptr(transform_capacity_ * sizeof(Xyz::Matrix4F)),
+                     nullptr, GL_DYNAMIC_DRAW);
+    }
+    GlStats::set_buffer_subdata(
+        GL_TEXTURE_BUFFER, 0,
+        GLsizeiptr(transforms_.size() * sizeof(Xyz::Matrix4F)),
+        transforms_.data());
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, transform_texture_.get());
+
+    Tungsten::bind_vertex_array(vertex_array_);
+    upload_changes();
+    GlStats::multi_draw_elements_base_vertex(GL_TRIANGLES, counts_.data(),
+                                             GL_UNSIGNED_SHORT,
+                                             offsets_.data(),
+                                             GLsizei(counts_.size()),
+                                             base_vertexes_.data());
+}
+
+void MeshBatch::reserve(size_t vertex_count, size_t index_count)
+{
+    auto old_vertex_capacity = vertex_allocator_.capacity();
+    auto old_index_capacity = index_allocator_.capacity();
+    if (vertex_count <= old_vertex_capacity
+        && index_count <= old_index_capacity)
+    {
+        return;
+    }
+
+    // The index buffer binding and the attribute pointers are part of
+    // the vertex array's state.
+    Tungsten::bind_vertex_array(vertex_array_);
+    if (vertex_count > old_vertex_capacity)
+    {
+        auto capacity = grown_capacity(old_vertex_capacity, vertex_count);
+        grow_buffer(vertex_buffer_, GL_ARRAY_BUFFER,
+                    old_vertex_capacity * sizeof(BatchVertex),
+                    capacity * sizeof(BatchVertex));
+        vertex_allocator_.grow(capacity);
+        vertex_data_.resize(capacity);
+        define_vertex_attributes();
+    }
+
+    if (index_count > old_index_capacity)
+    {
+        auto capacity = grown_capacity(old_index_capacity, index_count);
+        grow_buffer(index_buffer_, GL_ELEMENT_ARRAY_BUFFER,
+                    old_index_capacity * sizeof(uint16_t),
+                    capacity * sizeof(uint16_t));
+        index_allocator_.grow(capacity);
+        index_data_.resize(capacity);
+    }
+}
+
+void MeshBatch::define_vertex_attributes()
+{
+    GLsizei row_size = sizeof(BatchVertex);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_.get());
+    Tungsten::enable_vertex_attribute(position_attr_);
+    Tungsten::define_vertex_attribute_pointer(
+        position_attr_, 3, GL_FLOAT, false, row_size,
+        offsetof(BatchVertex, coords));
+    Tungsten::enable_vertex_attribute(normal_attr_);
+    Tungsten::define_vertex_attribute_pointer(
+        normal_attr_, 3, GL_FLOAT, false, row_size,
+        offsetof(BatchVertex, normal));
+    Tungsten::enable_vertex_attribute(object_index_attr_);
+    Tungsten::define_vertex_attribute_pointer(
+        object_index_attr_, 1, GL_FLOAT, false, row_size,
+        offsetof(BatchVertex, object_index));
+}
+
+void MeshBatch::update_draw_commands()
+{
+    counts_.clear();
+    offsets_.clear();
+    base_vertexes_.clear();
+    for (const auto& obj : objects_)
+    {
+        if (!obj.active || obj.index_count == 0)
+            continue;
+        counts_.push_back(GLsizei(obj.index_count));
+        offsets_.push_back(reinterpret_cast<const void*>(
+            obj.first_index * sizeof(uint16_t)));
+        base_vertexes_.push_back(GLint(obj.first_vertex));
+    }
+    update_commands_ = false;
+}
+
+void MeshBatch::upload_changes()
+{
+    if (changed_vertexes_.begin < changed_vertexes_.end)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_.get());
+        upload_span(GL_ARRAY_BUFFER, vertex_data_, changed_vertexes_);
+    }
+    // The index buffer is bound to the vertex array.
+    upload_span(GL_ELEMENT_ARRAY_BUFFER, index_data_, changed_indexes_);
+}
@@ -0,0 +1,111 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <vector>
+#include "RangeAllocator.hpp"
+#include "SceneShaderProgram.hpp"
+
+struct BatchVertex
+{
+    Xyz::Vector3F coords;
+    Xyz::Vector3F normal;
+    float object_index;
+};
+
+/**
+ * @brief Keeps the meshes of many objects in one vertex buffer and one
+ *  index buffer and draws all of them with a single
+ *  glMultiDrawElementsBaseVertex.
+ *
+ * Each object gets a range in both buffers from a RangeAllocator, the
+ * buffers grow when they are full. set_mesh() only writes to CPU copies
+ * of the buffers, draw() uploads the span that has changed in each
+ * buffer with a single call, however many objects have changed. The objects' model-view matrices
+ * are stored in a buffer texture that the vertex shader indexes with
+ * the object index in each vertex.
+ */
+class MeshBatch
+{
+public:
+    void setup(const SceneShaderProgram<ShaderVariant::Active>& program);
+
+    /**
+     * @brief Adds an object with an empty mesh and returns its index.
+     */
+    size_t add_object();
+
+    void remove_object(size_t object);
+
+    [[nodiscard]]
+    size_t object_count() const;
+
+    void set_mesh(size_t object, const Xyz::Mesh<float>& mesh);
+
+    void set_transform(size_t object, const Xyz::Matrix4F& transform);
+
+    /**
+     * @brief Uploads the transforms and draws all objects.
+     *
+     * The program must be current, and its transforms uniform must
+     * refer to texture unit 0.
+     */
+    void draw();
+private:
+    /// A range of changed vertexes or indexes, empty if begin >= end.
+    struct Span
+    {
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    struct Object
+    {
+        size_t first_vertex = 0;
+        size_t vertex_count = 0;
+        size_t first_index = 0;
+        size_t index_count = 0;
+        bool active = false;
+    };
+
+    void reserve(size_t vertex_count, size_t index_count);
+
+    void define_vertex_attributes();
+
+    void update_draw_commands();
+
+    void upload_changes();
+
+    GLuint position_attr_ = 0;
+    GLuint normal_attr_ = 0;
+    GLuint object_index_attr_ = 0;
+
+    Tungsten::VertexArrayHandle vertex_array_;
+    Tungsten::BufferHandle vertex_buffer_;
+    Tungsten::BufferHandle index_buffer_;
+    Tungsten::BufferHandle transform_buffer_;
+    Tungsten::TextureHandle transform_texture_;
+
+    RangeAllocator vertex_allocator_;
+    RangeAllocator index_allocator_;
+
+    std::vector<Object> objects_;
+    std::vector<size_t> free_objects_;
+    std::vector<Xyz::Matrix4F> transforms_;
+    size_t transform_capacity_ = 0;
+
+    bool update_commands_ = false;
+    std::vector<GLsizei> counts_;
+    std::vector<const void*> offsets_;
+    std::vector<GLint> base_vertexes_;
+
+    // CPU copies of the vertex and index buffers.
+    std::vector<BatchVertex> vertex_data_;
+    std::vector<uint16_t> index_data_;
+    Span changed_vertexes_;
+    Span changed_indexes_;
+};
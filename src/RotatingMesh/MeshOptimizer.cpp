@@ -0,0 +1,320 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+namespace
+{
+    constexpr uint32_t NO_VERTEX = UINT32_MAX;
+
+    /**
+     * @brief The triangles that use each vertex, as offsets into
+     *  @a triangles.
+     */
+    struct Adjacency
+    {
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> triangles;
+    };
+
+    Adjacency make_adjacency(const std::vector<uint32_t>& indexes,
+                             size_t vertex_count)
+    {
+        Adjacency result;
+        result.offsets.assign(vertex_count + 1, 0);
+        for (auto index : indexes)
+            ++result.offsets[index + 1];
+        std::partial_sum(result.offsets.begin(), result.offsets.end(),
+                         result.offsets.begin());
+
+        result.triangles.resize(indexes.size());
+        auto next = result.offsets;
+        for (size_t i = 0; i < indexes.size(); ++i)
+            result.triangles[next[indexes[i]]++] = uint32_t(i / 3);
+        return result;
+    }
+
+    /**
+     * @brief Sorts the clusters so that the ones facing away from the
+     *  mesh's center are drawn first.
+     *
+     * Outward-facing triangles are more likely to occlude the rest of
+     * the mesh, so drawing them first lets the depth test reject more
+     * fragments. This is the view-independent sort from the Tipsify
+     * paper, without its cluster merging.
+     */
+    std::vector<uint32_t> sort_clusters(const Xyz::Mesh<float>& mesh,
+                                        const std::vector<uint32_t>& triangles,
+                                        const std::vector<size_t>& clusters)
+    {
+        const auto& vertexes = mesh.vertexes();
+        const auto& faces = mesh.faces();
+        const auto triangle_count = triangles.size();
+
+        auto centroid = [&](size_t first, size_t last)
+        {
+            std::array<double, 3> sum = {};
+            for (size_t i = first; i < last; ++i)
+            {
+                const auto& face = faces[triangles[i]];
+                for (unsigned k = 0; k < 3; ++k)
+                {
+                    for (unsigned j = 0; j < 3; ++j)
+                        sum[j] += vertexes[face[k]][j];
+                }
+            }
+            for (auto& value : sum)
+                value /= double(3 * (last - first));
+            return sum;
+        };
+
+        auto mesh_center = centroid(0, triangle_count);
+
+        struct Cluster
+        {
+            size_t first;
+            size_t last;
+            double key;
+        };
+
+        std::vector<Cluster> sorted;
+        for (size_t i = 0; i < clusters.size(); ++i)
+        {
+            auto first = clusters[i];
+            auto last = i + 1 < clusters.size() ? clusters[i + 1]
+                                                : triangle_count;
+            auto center = centroid(first, last);
+            std::array<double, 3> normal = {};
+            for (size_t t = first; t < last; ++t)
+            {
+                const auto& face = faces[triangles[t]];
+                const auto& a = vertexes[face[0]];
+                const auto& b = vertexes[face[1]];
+                const auto& c = vertexes[face[2]];
+                // Unnormalized cross product, i.e. weighted by area.
+                double ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+                double ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+                normal[0] += ab[1] * ac[2] - ab[2] * ac[1];
+                normal[1] += ab[2] * ac[0] - ab[0] * ac[2];
+                normal[2] += ab[0] * ac[1] - ab[1] * ac[0];
+            }
+            double key = 0;
+            for (unsigned j = 0; j < 3; ++j)
+                key += (center[j] - mesh_center[j]) * normal[j];
+            sorted.push_back({first, last, key});
+        }
+
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const Cluster& a, const Cluster& b)
+                         {
+                             return a.key > b.key;
+                         });
+
+        std::vector<uint32_t> result;
+        result.reserve(triangle_count);
+        for (const auto& cluster : sorted)
+        {
+            result.insert(result.end(),
+                          triangles.begin() + ptrdiff_t(cluster.first),
+                          triangles.begin() + ptrdiff_t(cluster.last));
+        }
+        return result;
+    }
+}
+
+double compute_acmr(const std::vector<uint32_t>& indexes,
+                    size_t vertex_count, size_t cache_size)
+{
+    if (indexes.empty())
+        return 0;
+
+    // A vertex is in the FIFO cache if fewer than cache_size misses
+    // have happened since it was added.
+    std::vector<size_t> added(vertex_count, 0);
+    std::vector<bool> seen(vertex_count, false);
+    size_t misses = 0;
+    for (auto index : indexes)
+    {
+        if (seen[index] && misses - added[index] < cache_size)
+            continue;
+        seen[index] = true;
+        added[index] = misses++;
+    }
+    return double(misses) / double(indexes.size() / 3);
+}
+
+std::vector<uint32_t> tipsify(const std::vector<uint32_t>& indexes,
+                              size_t vertex_count, size_t cache_size,
+                              std::vector<size_t>* clusters)
+{
+    const auto adjacency = make_adjacency(indexes, vertex_count);
+
+    std::vector<uint32_t> live(vertex_count, 0);
+    for (auto index : indexes)
+        ++live[index];
+
+    std::vector<size_t> cache_time(vertex_count, 0);
+    std::vector<bool> emitted(indexes.size() / 3, false);
+    std::vector<uint32_t> dead_end;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> result;
+    result.reserve(indexes.size() / 3);
+    size_t time = cache_size + 1;
+    uint32_t cursor = 0;
+
+    auto skip_dead_end = [&]() -> uint32_t
+    {
+        while (!dead_end.empty())
+        {
+            auto vertex = dead_end.back();
+            dead_end.pop_back();
+            if (live[vertex] > 0)
+                return vertex;
+        }
+        for (; cursor < vertex_count; ++cursor)
+        {
+            if (live[cursor] > 0)
+                return cursor;
+        }
+        return NO_VERTEX;
+    };
+
+    auto fanning = skip_dead_end();
+    if (clusters)
+        clusters->clear();
+    bool new_cluster = true;
+    while (fanning != NO_VERTEX)
+    {
+        if (new_cluster && clusters)
+            clusters->push_back(result.size());
+
+        candidates.clear();
+        for (auto i = adjacency.offsets[fanning];
+             i < adjacency.offsets[fanning + 1]; ++i)
+        {
+            auto triangle = adjacency.triangles[i];
+            if (emitted[triangle])
+                continue;
+            for (size_t j = 3 * triangle; j < 3 * triangle + 3; ++j)
+            {
+                auto vertex = indexes[j];
+                dead_end.push_back(vertex);
+                candidates.push_back(vertex);
+                --live[vertex];
+                if (time - cache_time[vertex] > cache_size)
+                    cache_time[vertex] = time++;
+            }
+            emitted[triangle] = true;
+            result.push_back(triangle);
+        }
+
+        // Prefer the candidate that has been in the cache the longest
+        // and will still be in it after its remaining triangles have
+        // been emitted.
+        auto next = NO_VERTEX;
+        size_t best_priority = 0;
+        for (auto vertex : candidates)
+        {
+            if (live[vertex] == 0)
+                continue;
+            size_t priority = 1;
+            if (time - cache_time[vertex] + 2 * live[vertex] <= cache_size)
+                priority += time - cache_time[vertex];
+            if (next == NO_VERTEX || priority > best_priority)
+            {
+                best_priority = priority;
+                next = vertex;
+            }
+        }
+
+        new_cluster = next == NO_VERTEX;
+        fanning = new_cluster ? skip_dead_end() : next;
+    }
+    return result;
+}
+
+MeshOptimizer::MeshOptimizer(MeshOptimization optimization,
+                             size_t cache_size)
+    : optimization_(optimization),
+      cache_size_(cache_size)
+{}
+
+const MeshLayout& MeshOptimizer::layout(const Xyz::Mesh<float>& mesh,
+                                        uint64_t topology)
+{
+    if (auto it = cache_.find(topology); it != cache_.end())
+        return it->second;
+
+    std::vector<uint32_t> indexes;
+    indexes.reserve(mesh.faces().size() * 3);
+    for (const auto& face : mesh.faces())
+        indexes.insert(indexes.end(), {uint32_t(face[0]), uint32_t(face[1]),
+                                        uint32_t(face[2])});
+
+    auto& layout = cache_.emplace(topology, make_layout(mesh, indexes))
+        .first->second;
+    std::cout << std::fixed << std::setprecision(3)
+              << "optimized mesh with " << mesh.vertexes().size()
+              << " vertexes and " << mesh.faces().size()
+              << " triangles: ACMR " << layout.acmr_before << " -> "
+              << layout.acmr_after << "\n";
+    return layout;
+}
+
+MeshLayout MeshOptimizer::make_layout(const Xyz::Mesh<float>& mesh,
+                                      const std::vector<uint32_t>& indexes) const
+{
+    const auto vertex_count = mesh.vertexes().size();
+
+    MeshLayout result;
+    result.acmr_before = compute_acmr(indexes, vertex_count, cache_size_);
+
+    std::vector<size_t> clusters;
+    result.face_order = tipsify(indexes, vertex_count, cache_size_,
+                                &clusters);
+    if (optimization_ == MeshOptimization::VERTEX_CACHE_AND_OVERDRAW)
+        result.face_order = sort_clusters(mesh, result.face_order, clusters);
+
+    std::vector<uint32_t> ordered;
+    ordered.reserve(indexes.size());
+    for (auto triangle : result.face_order)
+    {
+        ordered.insert(ordered.end(),
+                       indexes.begin() + ptrdiff_t(3 * triangle),
+                       indexes.begin() + ptrdiff_t(3 * triangle + 3));
+    }
+    result.acmr_after = compute_acmr(ordered, vertex_count, cache_size_);
+
+    // Number the vertexes in the order they are first used, so that
+    // the vertex fetches follow the index stream.
+    std::vector<uint32_t> new_index(vertex_count, NO_VERTEX);
+    result.vertex_order.reserve(vertex_count);
+    result.indexes.reserve(ordered.size());
+    for (auto index : ordered)
+    {
+        if (new_index[index] == NO_VERTEX)
+        {
+            new_index[index] = uint32_t(result.vertex_order.size());
+            result.vertex_order.push_back(index);
+        }
+        result.indexes.push_back(new_index[index]);
+    }
+    // Unused vertexes are kept at the end.
+    for (uint32_t i = 0; i < vertex_count; ++i)
+    {
+        if (new_index[i] == NO_VERTEX)
+            result.vertex_order.push_back(i);
+    }
+
+    return result;
+}
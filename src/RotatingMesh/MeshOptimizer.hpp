@@ -0,0 +1,104 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <Tungsten/Tungsten.hpp>
+
+enum class MeshOptimization
+{
+    NONE,
+    /// Reorder triangles for the post-transform vertex cache and
+    /// vertexes for fetch locality.
+    VERTEX_CACHE,
+    /// As VERTEX_CACHE, and also sort clusters of triangles so that
+    /// outward-facing clusters are drawn first.
+    VERTEX_CACHE_AND_OVERDRAW
+};
+
+/**
+ * @brief The order in which to upload and draw a mesh's vertexes and
+ *  triangles.
+ */
+struct MeshLayout
+{
+    /// face_order[i] is the index in the mesh of the i'th triangle.
+    std::vector<uint32_t> face_order;
+    /// vertex_order[i] is the index in the mesh of the i'th vertex.
+    std::vector<uint32_t> vertex_order;
+    /// Three indexes per triangle, in face_order and referring to the
+    /// vertexes in vertex_order.
+    std::vector<uint32_t> indexes;
+    /// Average cache miss ratio (transformed vertexes per triangle)
+    /// before and after the optimization.
+    double acmr_before = 0;
+    double acmr_after = 0;
+};
+
+/**
+ * @brief Simulates a FIFO post-transform cache with @a cache_size
+ *  entries and returns the average number of cache misses per
+ *  triangle.
+ */
+[[nodiscard]]
+double compute_acmr(const std::vector<uint32_t>& indexes,
+                    size_t vertex_count, size_t cache_size);
+
+/**
+ * @brief Returns the order in which to draw the triangles in
+ *  @a indexes, computed with Tipsify (Sander, Nehab and Barczak, 2007).
+ *
+ * @param clusters If not null, receives the position in the result of
+ *  the first triangle of each cluster, i.e. each place where Tipsify
+ *  had to jump to a vertex outside the cache.
+ */
+[[nodiscard]]
+std::vector<uint32_t> tipsify(const std::vector<uint32_t>& indexes,
+                              size_t vertex_count, size_t cache_size,
+                              std::vector<size_t>* clusters = nullptr);
+
+/**
+ * @brief Computes and caches optimized layouts for meshes.
+ *
+ * A layout only depends on a mesh's topology, i.e. its vertex count
+ * and faces, so meshes that only differ in vertex positions share
+ * the same layout. The caller identifies the topology with a key, the
+ * overdraw sort uses the vertex positions of the first mesh with a
+ * given key.
+ */
+class MeshOptimizer
+{
+public:
+    static constexpr size_t DEFAULT_CACHE_SIZE = 16;
+
+    /// @a optimization must not be MeshOptimization::NONE.
+    explicit MeshOptimizer(MeshOptimization optimization,
+                           size_t cache_size = DEFAULT_CACHE_SIZE);
+
+    /**
+     * @brief Returns the layout for @a mesh, computing it and printing
+     *  its ACMR statistics if this is a new @a topology.
+     *
+     * Meshes with different vertex counts or faces must have different
+     * topology keys. The reference is valid until the optimizer is
+     * destroyed.
+     */
+    const MeshLayout& layout(const Xyz::Mesh<float>& mesh,
+                             uint64_t topology);
+private:
+    [[nodiscard]]
+    MeshLayout make_layout(const Xyz::Mesh<float>& mesh,
+                           const std::vector<uint32_t>& indexes) const;
+
+    MeshOptimization optimization_;
+    size_t cache_size_;
+    /// Maps topology keys to layouts. Rehashing doesn't move the
+    /// elements, so the references returned by layout() stay valid.
+    std::unordered_map<uint64_t, MeshLayout> cache_;
+};
@@ -0,0 +1,143 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "MeshRenderer.hpp"
+
+#include "GlStats.hpp"
+
+void add_mesh(Tungsten::ArrayBuffer<Point>& buffer,
+              const Xyz::Mesh<float>& mesh,
+              const MeshLayout* layout)
+{
+    Tungsten::ArrayBufferBuilder builder(buffer);
+    builder.reserve_vertexes(mesh.faces().size() * 3);
+    builder.reserve_indexes(mesh.faces().size() * 3);
+    int n = 0;
+    for (size_t i = 0; i < mesh.faces().size(); ++i)
+    {
+        const auto& face = mesh.faces()[layout ? layout->face_order[i] : i];
+        auto normal = mesh.normal(face);
+        builder.add_vertex({mesh.vertexes()[face[0]], normal});
+        builder.add_vertex({mesh.vertexes()[face[1]], normal});
+        builder.add_vertex({mesh.vertexes()[face[2]], normal});
+        builder.add_indexes(n, n + 1, n + 2);
+        n += 3;
+    }
+}
+
+void add_mesh(Tungsten::ArrayBuffer<Xyz::Vector3F>& buffer,
+              const Xyz::Mesh<float>& mesh,
+              const MeshLayout* layout)
+{
+    Tungsten::ArrayBufferBuilder builder(buffer);
+    builder.reserve_vertexes(mesh.vertexes().size());
+    builder.reserve_indexes(mesh.faces().size() * 3);
+    if (!layout)
+    {
+        for (const auto& vertex : mesh.vertexes())
+            builder.add_vertex(vertex);
+        for (const auto& face : mesh.faces())
+            builder.add_indexes(face[0], face[1], face[2]);
+        return;
+    }
+
+    for (auto index : layout->vertex_order)
+        builder.add_vertex(mesh.vertexes()[index]);
+    const auto& indexes = layout->indexes;
+    for (size_t i = 0; i + 2 < indexes.size(); i += 3)
+        builder.add_indexes(indexes[i], indexes[i + 1], indexes[i + 2]);
+}
+
+void MeshRenderer::setup(const Xyz::Matrix4F& proj_matrix,
+                         const Xyz::Mesh<float>& mesh,
+                         uint64_t topology,
+                         bool flat_shading,
+                         MeshOptimization optimization)
+{
+    flat_shading_ = flat_shading;
+    if (optimization != MeshOptimization::NONE)
+        optimizer_ = std::make_unique<MeshOptimizer>(optimization);
+
+    vertex_array_ = Tungsten::generate_vertex_array();
+    Tungsten::bind_vertex_array(vertex_array_);
+
+    buffers_ = Tungsten::generate_buffers(2);
+    if (flat_shading_)
+    {
+        Tungsten::ArrayBuffer<Xyz::Vector3F> buffer;
+        add_mesh(buffer, mesh, layout(mesh, topology));
+        Tungsten::set_buffers(buffers_[0], buffers_[1], buffer,
+                              GL_DYNAMIC_DRAW);
+        element_count_ = GLsizei(buffer.indexes.size());
+        flat_program_.setup();
+
+        Tungsten::enable_vertex_attribute(flat_program_.position_attr);
+        Tungsten::define_vertex_attribute_pointer(flat_program_.position_attr, 3,
+                                                  GL_FLOAT, false, sizeof(Xyz::Vector3F), 0);
+
+        GlStats::set_uniform(flat_program_.proj_matrix, proj_matrix);
+        return;
+    }
+
+    Tungsten::ArrayBuffer<Point> buffer;
+    add_mesh(buffer, mesh, layout(mesh, topology));
+    Tungsten::set_buffers(buffers_[0], buffers_[1], buffer,
+                          GL_DYNAMIC_DRAW);
+    element_count_ = GLsizei(buffer.indexes.size());
+    program_.setup();
+
+    GLsizei row_size = sizeof(Point);
+    Tungsten::enable_vertex_attribute(program_.position_attr);
+    Tungsten::define_vertex_attribute_pointer(program_.position_attr, 3,
+                                              GL_FLOAT, false, row_size, 0);
+    Tungsten::enable_vertex_attribute(program_.normal_attr);
+    Tungsten::define_vertex_attribute_pointer(program_.normal_attr, 3,
+                                              GL_FLOAT, false, row_size, 3 * sizeof(GLfloat));
+
+    GlStats::set_uniform(program_.proj_matrix, proj_matrix);
+}
+
+void MeshRenderer::set_mesh(const Xyz::Mesh<float>& mesh, uint64_t topology)
+{
+    if (flat_shading_)
+        update_buffers<Xyz::Vector3F>(mesh, topology);
+    else
+        update_buffers<Point>(mesh, topology);
+}
+
+void MeshRenderer::draw(const Xyz::Matrix4F& model_matrix)
+{
+    if (flat_shading_)
+        GlStats::set_uniform(flat_program_.mv_matrix, model_matrix);
+    else
+        GlStats::set_uniform(program_.mv_matrix, model_matrix);
+
+    GlStats::draw_elements(GL_TRIANGLES, element_count_,
+                           GL_UNSIGNED_SHORT, nullptr);
+}
+
+template <typename T>
+void MeshRenderer::update_buffers(const Xyz::Mesh<float>& mesh,
+                                  uint64_t topology)
+{
+    Tungsten::ArrayBuffer<T> buffer;
+    add_mesh(buffer, mesh, layout(mesh, topology));
+
+    auto [v_buf, v_size] = buffer.array_buffer();
+    GlStats::set_buffer_subdata(GL_ARRAY_BUFFER, 0,
+                                GLsizeiptr(v_size), v_buf);
+    auto [i_buf, i_size] = buffer.index_buffer();
+    GlStats::set_buffer_subdata(GL_ELEMENT_ARRAY_BUFFER, 0,
+                                GLsizeiptr(i_size), i_buf);
+    element_count_ = GLsizei(buffer.indexes.size());
+}
+
+const MeshLayout* MeshRenderer::layout(const Xyz::Mesh<float>& mesh,
+                                       uint64_t topology)
+{
+    return optimizer_ ? &optimizer_->layout(mesh, topology) : nullptr;
+}
@@ -0,0 +1,73 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <memory>
+#include "FlatPhongShaderProgram.hpp"
+#include "MeshOptimizer.hpp"
+#include "PhongShaderProgram.hpp"
+
+struct Point
+{
+    Xyz::Vector3F coords;
+    Xyz::Vector3F normal;
+};
+
+/**
+ * @brief Adds three vertexes with the face normal for each face.
+ *
+ * If @a layout isn't null, the faces are added in its face order.
+ */
+void add_mesh(Tungsten::ArrayBuffer<Point>& buffer,
+              const Xyz::Mesh<float>& mesh,
+              const MeshLayout* layout = nullptr);
+
+/**
+ * @brief Adds the mesh's vertexes without normals, each vertex is
+ *  shared by all the faces that use it.
+ *
+ * If @a layout isn't null, the vertexes and faces are added in its
+ * order.
+ */
+void add_mesh(Tungsten::ArrayBuffer<Xyz::Vector3F>& buffer,
+              const Xyz::Mesh<float>& mesh,
+              const MeshLayout* layout = nullptr);
+
+/**
+ * @brief Owns the buffers and program that draw a single mesh.
+ *
+ * The buffers are sized by the mesh passed to setup(), later meshes
+ * must not be larger. @a topology identifies the mesh's vertex count
+ * and faces, see MeshOptimizer::layout().
+ */
+class MeshRenderer
+{
+public:
+    void setup(const Xyz::Matrix4F& proj_matrix,
+               const Xyz::Mesh<float>& mesh,
+               uint64_t topology,
+               bool flat_shading,
+               MeshOptimization optimization = MeshOptimization::NONE);
+
+    void set_mesh(const Xyz::Mesh<float>& mesh, uint64_t topology);
+
+    void draw(const Xyz::Matrix4F& model_matrix);
+private:
+    template <typename T>
+    void update_buffers(const Xyz::Mesh<float>& mesh, uint64_t topology);
+
+    [[nodiscard]]
+    const MeshLayout* layout(const Xyz::Mesh<float>& mesh, uint64_t topology);
+
+    bool flat_shading_ = false;
+    std::unique_ptr<MeshOptimizer> optimizer_;
+    std::vector<Tungsten::BufferHandle> buffers_;
+    Tungsten::VertexArrayHandle vertex_array_;
+    PhongShaderProgram<ShaderVariant::Active> program_;
+    FlatPhongShaderProgram<ShaderVariant::Active> flat_program_;
+    GLsizei element_count_ = 0;
+};
@@ -0,0 +1,161 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Options.hpp"
+
+#include <charconv>
+#include <stdexcept>
+#include <string_view>
+
+namespace
+{
+    class ArgumentReader
+    {
+    public:
+        ArgumentReader(int argc, char* argv[])
+            : argc_(argc), argv_(argv)
+        {}
+
+        [[nodiscard]]
+        bool done() const
+        {
+            return index_ >= argc_;
+        }
+
+        [[nodiscard]]
+        std::string_view current() const
+        {
+            return argv_[index_];
+        }
+
+        /**
+         * @brief Returns true and sets @a value to true if the current
+         *  argument is @a flag.
+         */
+        bool read_flag(std::string_view flag, bool& value)
+        {
+            if (current() != flag)
+                return false;
+            value = true;
+            ++index_;
+            return true;
+        }
+
+        /**
+         * @brief Returns true if the current argument is @a option,
+         *  either as "option value" or "option=value".
+         */
+        bool read_option(std::string_view option, std::string& value)
+        {
+            auto arg = current();
+            if (arg.substr(0, option.size()) != option)
+                return false;
+
+            if (arg.size() == option.size())
+            {
+                if (index_ + 1 >= argc_)
+                {
+                    throw std::runtime_error(std::string(option)
+                                             + ": missing value.");
+                }
+                value = argv_[index_ + 1];
+                index_ += 2;
+                return true;
+            }
+
+            if (arg[option.size()] != '=')
+                return false;
+            value = arg.substr(option.size() + 1);
+            ++index_;
+            return true;
+        }
+
+        bool read_option(std::string_view option, size_t& value)
+        {
+            std::string str;
+            if (!read_option(option, str))
+                return false;
+
+            // Unlike std::stoul, from_chars doesn't accept a sign, so
+            // negative numbers don't wrap around to huge values.
+            auto end = str.data() + str.size();
+            auto [ptr, ec] = std::from_chars(str.data(), end, value);
+            if (ec != std::errc() || ptr != end || str.empty())
+            {
+                throw std::runtime_error(std::string(option)
+                                         + ": invalid number: " + str);
+            }
+            return true;
+        }
+
+        void skip()
+        {
+            argv_[kept_++] = argv_[index_++];
+        }
+
+        [[nodiscard]]
+        int kept() const
+        {
+            return kept_;
+        }
+    private:
+        int argc_;
+        char** argv_;
+        int index_ = 1;
+        int kept_ = 1;
+    };
+}
+
+RotatingMeshOptions extract_options(int& argc, char* argv[])
+{
+    RotatingMeshOptions result;
+    ArgumentReader reader(argc, argv);
+    bool optimize_mesh = false;
+    bool sort_for_overdraw = false;
+    while (!reader.done())
+    {
+        if (reader.read_flag("--optimize-mesh", optimize_mesh)
+            || reader.read_flag("--overdraw-sort", sort_for_overdraw)
+            || reader.read_flag("--gl-stats", result.show_gl_stats)
+            || reader.read_option("--gl-stats-file", result.gl_stats_file)
+            || reader.read_flag("--flat-shading", result.flat_shading)
+            || reader.read_flag("--render-thread", result.render_thread)
+            || reader.read_option("--scene", result.scene_size)
+            || reader.read_option("--record", result.record_file)
+            || reader.read_option("--replay", result.replay_file)
+            || reader.read_option("--unfocused-fps", result.unfocused_fps)
+            || reader.read_option("--max-fps", result.max_fps)
+            || reader.read_flag("--power-stats", result.power_stats))
+        {
+            continue;
+        }
+        reader.skip();
+    }
+
+    if (!result.record_file.empty() && !result.replay_file.empty())
+        throw std::runtime_error("--record and --replay can't be combined.");
+    if (result.render_thread && result.scene_size != 0)
+        throw std::runtime_error("--render-thread and --scene can't be combined.");
+    if ((optimize_mesh || sort_for_overdraw) && !result.flat_shading)
+        throw std::runtime_error("--optimize-mesh and --overdraw-sort require --flat-shading.");
+    if (sort_for_overdraw)
+        result.mesh_optimization = MeshOptimization::VERTEX_CACHE_AND_OVERDRAW;
+    else if (optimize_mesh)
+        result.mesh_optimization = MeshOptimization::VERTEX_CACHE;
+
+    constexpr size_t MAX_FPS = 1000;
+    if (result.unfocused_fps == 0 || result.unfocused_fps > MAX_FPS
+        || result.max_fps == 0 || result.max_fps > MAX_FPS)
+    {
+        throw std::runtime_error("--unfocused-fps and --max-fps must be"
+                                 " between 1 and 1000.");
+    }
+
+    argc = reader.kept();
+    argv[argc] = nullptr;
+    return result;
+}
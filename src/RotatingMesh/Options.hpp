@@ -0,0 +1,51 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <string>
+#include "MeshOptimizer.hpp"
+
+struct RotatingMeshOptions
+{
+    /// Show the GL statistics overlay at startup (toggle with S).
+    bool show_gl_stats = false;
+    /// Append a GL statistics summary to this file every few seconds.
+    std::string gl_stats_file;
+    /// Use position-only vertexes shared between faces, and compute
+    /// the face normals in the fragment shader.
+    bool flat_shading = false;
+    /// Reorder the mesh's triangles and vertexes before uploading it.
+    /// Requires flat_shading, the per-face vertexes of smooth shading
+    /// are never shared and gain nothing from the vertex cache.
+    MeshOptimization mesh_optimization = MeshOptimization::NONE;
+    /// Draw on a separate thread with its own GL context.
+    bool render_thread = false;
+    /// Draw a batched scene with this many prisms instead of one prism.
+    size_t scene_size = 0;
+    /// Write the key events and frame timestamps to this file.
+    std::string record_file;
+    /// Replay the key events and frame timestamps in this file, print
+    /// the distribution of frame times and quit.
+    std::string replay_file;
+    /// The frame rate while the window doesn't have input focus.
+    size_t unfocused_fps = 10;
+    /// The frame rate limit when vsync isn't available.
+    size_t max_fps = 60;
+    /// Print CPU and GPU busy time once a minute.
+    bool power_stats = false;
+};
+
+/**
+ * @brief Removes the options that are handled by RotatingMesh from
+ *  @a argv and returns their values.
+ *
+ * The remaining arguments are left for
+ * Tungsten::SdlApplication::parse_command_line_options.
+ *
+ * @throw std::runtime_error if an option is missing its value.
+ */
+RotatingMeshOptions extract_options(int& argc, char* argv[]);
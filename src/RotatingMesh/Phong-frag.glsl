@@ -16,9 +16,16 @@ in VS_OUT
     vec3 view;
 } fs_in;
 
-uniform vec3 u_diffuse_albedo = vec3(0.5, 0.2, 0.7);
-uniform vec3 u_specular_albedo = vec3(0.7);
-uniform float u_specular_power = 128.0;
+#ifndef MATERIAL_STORAGE
+#define MATERIAL_STORAGE uniform
+#endif
+#ifndef SPECULAR_POWER_STORAGE
+#define SPECULAR_POWER_STORAGE uniform
+#endif
+
+MATERIAL_STORAGE vec3 u_diffuse_albedo = vec3(0.5, 0.2, 0.7);
+MATERIAL_STORAGE vec3 u_specular_albedo = vec3(0.7);
+SPECULAR_POWER_STORAGE float u_specular_power = 128.0;
 
 void main()
 {
@@ -26,10 +33,13 @@ void main()
     vec3 light = normalize(fs_in.light);
     vec3 view = normalize(fs_in.view);
 
-    vec3 ref = reflect(-light, normal);
-
     vec3 diffuse = max(dot(normal, light), 0.0) * u_diffuse_albedo;
+#ifdef NO_SPECULAR
+    color = vec4(diffuse, 1.0);
+#else
+    vec3 ref = reflect(-light, normal);
     vec3 specular = pow(max(dot(ref, view), 0.0), u_specular_power)
                     * u_specular_albedo;
     color = vec4(diffuse + specular, 1.0);
+#endif
 }
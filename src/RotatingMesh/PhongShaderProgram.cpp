@@ -7,18 +7,18 @@
 //****************************************************************************
 #include "PhongShaderProgram.hpp"
 
-#include "Phong-frag.glsl.hpp"
 #include "Phong-vert.glsl.hpp"
 
-void PhongShaderProgram::setup()
+template <typename Variant>
+void PhongShaderProgram<Variant>::setup()
 {
     program = Tungsten::create_program();
     auto vertexShader = Tungsten::create_shader(GL_VERTEX_SHADER,
                                                 Phong_vert);
     Tungsten::attach_shader(program, vertexShader);
 
-    auto fragmentShader = Tungsten::create_shader(GL_FRAGMENT_SHADER,
-                                                  Phong_frag);
+    auto fragmentShader = Tungsten::create_shader(
+        GL_FRAGMENT_SHADER, Variant::phong_fragment_shader());
     Tungsten::attach_shader(program, fragmentShader);
     Tungsten::link_program(program);
     Tungsten::use_program(program);
@@ -30,7 +30,16 @@ void PhongShaderProgram::setup()
     proj_matrix = Tungsten::get_uniform<Xyz::Matrix4F>(program, "u_proj_matrix");
 
     light_pos = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_light_pos");
-    diffuse_albedo = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_diffuse_albedo");
-    specular_albedo = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_specular_albedo");
-    specular_power = Tungsten::get_uniform<float>(program, "u_specular_power");
+    if constexpr (!Variant::FIXED_MATERIAL)
+    {
+        diffuse_albedo = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_diffuse_albedo");
+        specular_albedo = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_specular_albedo");
+    }
+    if constexpr (!Variant::FIXED_SPECULAR_POWER)
+        specular_power = Tungsten::get_uniform<float>(program, "u_specular_power");
 }
+
+template class PhongShaderProgram<ShaderVariant::Dynamic>;
+template class PhongShaderProgram<ShaderVariant::FixedSpecularPower>;
+template class PhongShaderProgram<ShaderVariant::FixedMaterial>;
+template class PhongShaderProgram<ShaderVariant::Diffuse>;
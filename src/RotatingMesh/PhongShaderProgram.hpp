@@ -7,7 +7,12 @@
 //****************************************************************************
 #pragma once
 #include <Tungsten/Tungsten.hpp>
+#include "ShaderVariant.hpp"
 
+/**
+ * @brief Phong shading with per-vertex normals.
+ */
+template <typename Variant>
 class PhongShaderProgram
 {
 public:
@@ -19,9 +24,9 @@ public:
     Tungsten::Uniform<Xyz::Matrix4F> proj_matrix;
 
     Tungsten::Uniform<Xyz::Vector3F> light_pos;
-    Tungsten::Uniform<Xyz::Vector3F> diffuse_albedo;
-    Tungsten::Uniform<Xyz::Vector3F> specular_albedo;
-    Tungsten::Uniform<float> specular_power;
+    ShaderVariant::Uniform<!Variant::FIXED_MATERIAL, Xyz::Vector3F> diffuse_albedo;
+    ShaderVariant::Uniform<!Variant::FIXED_MATERIAL, Xyz::Vector3F> specular_albedo;
+    ShaderVariant::Uniform<!Variant::FIXED_SPECULAR_POWER, float> specular_power;
 
     GLuint position_attr;
     GLuint normal_attr;
@@ -0,0 +1,79 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "PolygonMesh.hpp"
+
+std::vector<Xyz::Vector2F> make_polygon(unsigned n)
+{
+    constexpr auto PI = Xyz::Constants<float>::PI;
+    std::vector<Xyz::Vector2F> result;
+    auto angle0 = 1.5f * PI - PI / float(n);
+    for (unsigned i = 0; i < n; ++i)
+    {
+        auto angle = angle0 + float(i) * 2 * PI / float(n);
+        result.push_back({cos(angle), sin(angle)});
+    }
+    return result;
+}
+
+std::vector<Xyz::Vector2F> make_transition_polygon(unsigned n, float fraction)
+{
+    if (fraction <= 0)
+        return make_polygon(n);
+    if (fraction >= 1)
+        return make_polygon(n + 1);
+    const auto points0 = make_polygon(n);
+    const auto points1 = make_polygon(n + 1);
+    std::vector<Xyz::Vector2F> result;
+    for (unsigned i = 0; i < n; ++i)
+        result.push_back(points0[i] + (points1[i] - points0[i]) * fraction);
+    result.push_back(points0[0] + (points1.back() - points0[0]) * fraction);
+    return result;
+}
+
+Xyz::Mesh<float> make_polygon_mesh(unsigned n, float fraction)
+{
+    const auto RADIUS = sqrt(2.0f);
+    auto points = make_transition_polygon(n, fraction);
+    Xyz::Mesh<float> mesh;
+    for (auto p : points)
+    {
+        p *= RADIUS;
+        mesh.add_vertex({p[0], p[1], -1});
+        mesh.add_vertex({p[0], p[1], 1});
+    }
+    if (fraction > 0)
+        n += 1;
+    for (unsigned i = 0; i < n - 1; ++i)
+    {
+        auto j = i * 2;
+        mesh.add_face({j, j + 2, j + 1});
+        mesh.add_face({j + 2, j + 3, j + 1});
+    }
+    auto bottom_center = uint32_t(mesh.vertexes().size());
+    mesh.add_vertex({0, 0, -1});
+    auto top_center = uint32_t(mesh.vertexes().size());
+    mesh.add_vertex({0, 0, 1});
+    mesh.add_face({2 * n - 2, 0, 2 * n - 1});
+    mesh.add_face({0, 1, 2 * n - 1});
+    for (unsigned i = 0; i < n - 1; ++i)
+    {
+        auto j = i * 2;
+        mesh.add_face({j + 1, j + 3, top_center});
+        mesh.add_face({j + 2, j, bottom_center});
+    }
+
+    mesh.add_face({2 * n - 1, 1, top_center});
+    mesh.add_face({0, 2 * n - 2, bottom_center});
+
+    return mesh;
+}
+
+uint64_t polygon_mesh_topology(unsigned n, float fraction)
+{
+    return fraction > 0 ? n + 1 : n;
+}
@@ -0,0 +1,32 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <Tungsten/Tungsten.hpp>
+
+std::vector<Xyz::Vector2F> make_polygon(unsigned n);
+
+/**
+ * @brief Returns a polygon that is @a fraction of the way between
+ *  a polygon with @a n sides and one with n + 1 sides.
+ */
+std::vector<Xyz::Vector2F> make_transition_polygon(unsigned n, float fraction);
+
+/**
+ * @brief Returns a prism whose cross-section is the transition polygon
+ *  for @a n and @a fraction.
+ */
+Xyz::Mesh<float> make_polygon_mesh(unsigned n, float fraction);
+
+/**
+ * @brief Returns a key that is the same for the meshes returned by
+ *  make_polygon_mesh() if and only if they have the same vertexes and
+ *  faces, i.e. only differ in vertex positions.
+ */
+uint64_t polygon_mesh_topology(unsigned n, float fraction);
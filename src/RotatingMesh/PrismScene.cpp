@@ -0,0 +1,79 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "PrismScene.hpp"
+
+#include <cmath>
+#include "GlStats.hpp"
+#include "PolygonMesh.hpp"
+
+namespace
+{
+    constexpr unsigned MIN_SIDES = 3;
+    constexpr unsigned SIDE_VARIATIONS = 8;
+    // The width of the grid in world coordinates.
+    constexpr float GRID_WIDTH = 5;
+}
+
+PrismScene::PrismScene(size_t size)
+    : size_(size)
+{}
+
+void PrismScene::setup(const Xyz::Matrix4F& proj_matrix)
+{
+    program_.setup();
+    GlStats::set_uniform(program_.proj_matrix, proj_matrix);
+    GlStats::set_uniform(program_.transforms, 0);
+    batch_.setup(program_);
+
+    auto columns = unsigned(std::ceil(std::sqrt(float(size_))));
+    auto spacing = GRID_WIDTH / float(columns);
+    // The prisms' radius is sqrt(2).
+    auto scale = spacing / 3.0f;
+    auto offset = (spacing - GRID_WIDTH) / 2;
+
+    for (size_t i = 0; i < size_; ++i)
+    {
+        Prism prism;
+        prism.object = batch_.add_object();
+        prism.sides = MIN_SIDES + unsigned(i % SIDE_VARIATIONS);
+        prism.phase = float(i) * 0.7f;
+        prism.speed = 0.001f + 0.0001f * float(i % 5);
+        auto x = offset + float(i % columns) * spacing;
+        auto y = offset + float(i / columns) * spacing;
+        prism.placement = Xyz::translate4<float>(x, y, 0)
+                          * Xyz::scale4<float>(scale, scale, scale);
+        prisms_.push_back(prism);
+    }
+}
+
+void PrismScene::update(uint32_t ticks)
+{
+    for (auto& prism : prisms_)
+    {
+        auto t = float(ticks) * prism.speed + prism.phase;
+        auto value = float(prism.sides) + 0.5f - 0.5f * std::cos(t);
+        if (value != prism.value)
+        {
+            float int_part;
+            float fraction = std::modf(value, &int_part);
+            batch_.set_mesh(prism.object,
+                            make_polygon_mesh(unsigned(int_part), fraction));
+            prism.value = value;
+        }
+
+        auto angle = Xyz::to_radians(float(ticks) / 50.0f + prism.phase);
+        batch_.set_transform(prism.object,
+                             prism.placement * Xyz::rotate_z(angle));
+    }
+}
+
+void PrismScene::draw()
+{
+    GlStats::use_program(program_.program);
+    batch_.draw();
+}
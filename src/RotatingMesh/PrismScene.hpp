@@ -0,0 +1,40 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include "MeshBatch.hpp"
+
+/**
+ * @brief A grid of rotating prisms that each morph between their own
+ *  pair of side counts. All prisms are drawn with one MeshBatch.
+ */
+class PrismScene
+{
+public:
+    explicit PrismScene(size_t size);
+
+    void setup(const Xyz::Matrix4F& proj_matrix);
+
+    void update(uint32_t ticks);
+
+    void draw();
+private:
+    struct Prism
+    {
+        size_t object = 0;
+        unsigned sides = 3;
+        float phase = 0;
+        float speed = 0;
+        Xyz::Matrix4F placement;
+        float value = -1;
+    };
+
+    size_t size_;
+    SceneShaderProgram<ShaderVariant::Active> program_;
+    MeshBatch batch_;
+    std::vector<Prism> prisms_;
+};
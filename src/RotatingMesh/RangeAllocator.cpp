@@ -0,0 +1,80 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "RangeAllocator.hpp"
+
+#include <iterator>
+#include <stdexcept>
+
+RangeAllocator::RangeAllocator(size_t capacity)
+{
+    grow(capacity);
+}
+
+std::optional<size_t> RangeAllocator::allocate(size_t size)
+{
+    if (size == 0)
+        return 0;
+
+    for (auto it = free_ranges_.begin(); it != free_ranges_.end(); ++it)
+    {
+        auto [offset, range_size] = *it;
+        if (range_size < size)
+            continue;
+
+        free_ranges_.erase(it);
+        if (range_size > size)
+            free_ranges_.emplace(offset + size, range_size - size);
+        return offset;
+    }
+    return {};
+}
+
+void RangeAllocator::free(size_t offset, size_t size)
+{
+    if (size == 0)
+        return;
+    if (offset + size > capacity_)
+        throw std::out_of_range("RangeAllocator: range is out of bounds.");
+    add_free_range(offset, size);
+}
+
+size_t RangeAllocator::capacity() const
+{
+    return capacity_;
+}
+
+void RangeAllocator::grow(size_t capacity)
+{
+    if (capacity <= capacity_)
+        return;
+    auto offset = capacity_;
+    capacity_ = capacity;
+    add_free_range(offset, capacity - offset);
+}
+
+void RangeAllocator::add_free_range(size_t offset, size_t size)
+{
+    auto next = free_ranges_.lower_bound(offset);
+    if (next != free_ranges_.end() && next->first == offset + size)
+    {
+        size += next->second;
+        next = free_ranges_.erase(next);
+    }
+
+    if (next != free_ranges_.begin())
+    {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == offset)
+        {
+            prev->second += size;
+            return;
+        }
+    }
+
+    free_ranges_.emplace_hint(next, offset, size);
+}
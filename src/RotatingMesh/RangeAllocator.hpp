@@ -0,0 +1,49 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <map>
+#include <optional>
+
+/**
+ * @brief Hands out non-overlapping ranges of a buffer with a fixed
+ *  capacity.
+ *
+ * Allocation is first-fit, freed ranges are merged with adjacent free
+ * ranges. The allocator only does the bookkeeping, it doesn't own any
+ * memory. Offsets and sizes are in whatever unit the caller uses.
+ */
+class RangeAllocator
+{
+public:
+    explicit RangeAllocator(size_t capacity = 0);
+
+    /**
+     * @brief Returns the offset of a free range of @a size units, or
+     *  nothing if there is no free range that is large enough.
+     */
+    [[nodiscard]]
+    std::optional<size_t> allocate(size_t size);
+
+    void free(size_t offset, size_t size);
+
+    [[nodiscard]]
+    size_t capacity() const;
+
+    /**
+     * @brief Adds the space between the current capacity and
+     *  @a capacity to the free ranges.
+     */
+    void grow(size_t capacity);
+private:
+    void add_free_range(size_t offset, size_t size);
+
+    /// Maps offsets to sizes.
+    std::map<size_t, size_t> free_ranges_;
+    size_t capacity_ = 0;
+};
@@ -0,0 +1,354 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "RenderThread.hpp"
+
+#include <stdexcept>
+#include <utility>
+#include "GlStats.hpp"
+
+namespace
+{
+    GLuint make_texture_framebuffer(GLuint texture)
+    {
+        GLuint framebuffer;
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                               GL_TEXTURE_2D, texture, 0);
+        return framebuffer;
+    }
+
+    void wait_and_delete(GLsync& sync)
+    {
+        if (!sync)
+            return;
+        glWaitSync(sync, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(sync);
+        sync = nullptr;
+    }
+}
+
+RenderThread::RenderThread(bool flat_shading, MeshOptimization optimization,
+                           std::string gl_stats_file,
+                           std::atomic<uint64_t>& gpu_nanoseconds)
+    : flat_shading_(flat_shading),
+      optimization_(optimization),
+      gl_stats_file_(std::move(gl_stats_file)),
+      gpu_nanoseconds_(gpu_nanoseconds)
+{}
+
+RenderThread::~RenderThread()
+{
+    stop();
+}
+
+void RenderThread::start(const Xyz::Matrix4F& proj_matrix,
+                         std::shared_ptr<const Xyz::Mesh<float>> mesh,
+                         uint64_t topology)
+{
+    proj_matrix_ = proj_matrix;
+    mesh_ = std::move(mesh);
+    topology_ = topology;
+
+    window_ = SDL_GL_GetCurrentWindow();
+    auto main_context = SDL_GL_GetCurrentContext();
+    if (!window_ || !main_context)
+        throw std::runtime_error("RenderThread: no current GL context.");
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    window_width_ = width_ = viewport[2];
+    window_height_ = height_ = viewport[3];
+
+    for (auto& target : targets_.slots())
+    {
+        glGenTextures(1, &target.texture);
+        glBindTexture(GL_TEXTURE_2D, target.texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width_, height_, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        target.width = width_;
+        target.height = height_;
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    // The textures must exist before the other context uses them.
+    glFinish();
+
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+    render_context_ = SDL_GL_CreateContext(window_);
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+    if (!render_context_)
+        throw std::runtime_error(std::string("RenderThread: ")
+                                 + SDL_GetError());
+    // Creating the context made it current on this thread.
+    SDL_GL_MakeCurrent(window_, main_context);
+
+    stop_ = false;
+    snapshot_pending_ = false;
+    thread_ = std::thread([this] {run();});
+}
+
+void RenderThread::stop()
+{
+    if (!thread_.joinable())
+        return;
+
+    {
+        std::lock_guard lock(wake_mutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+
+    for (auto& target : targets_.slots())
+    {
+        if (target.rendered)
+            glDeleteSync(target.rendered);
+        if (target.presented)
+            glDeleteSync(target.presented);
+        if (target.present_framebuffer)
+            glDeleteFramebuffers(1, &target.present_framebuffer);
+        glDeleteTextures(1, &target.texture);
+        target = {};
+    }
+
+    // Deleting the context also deletes its framebuffers.
+    SDL_GL_DeleteContext(render_context_);
+    render_context_ = nullptr;
+}
+
+FrameSnapshot& RenderThread::snapshot()
+{
+    return snapshots_.back();
+}
+
+void RenderThread::publish()
+{
+    auto& snapshot = snapshots_.back();
+    snapshot.width = window_width_;
+    snapshot.height = window_height_;
+    snapshots_.publish();
+    {
+        std::lock_guard lock(wake_mutex_);
+        snapshot_pending_ = true;
+    }
+    wake_.notify_one();
+}
+
+void RenderThread::update_size()
+{
+    int width = 0;
+    int height = 0;
+    SDL_GL_GetDrawableSize(window_, &width, &height);
+    // A minimized window may report an empty drawable.
+    if (width <= 0 || height <= 0)
+        return;
+    window_width_ = width;
+    window_height_ = height;
+}
+
+void RenderThread::present()
+{
+    if (failed_)
+    {
+        stop();
+        failed_ = false;
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+
+    targets_.update();
+    auto& target = targets_.front();
+
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    if (!target.has_frame)
+    {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        return;
+    }
+
+    wait_and_delete(target.rendered);
+    if (!target.present_framebuffer)
+    {
+        target.present_framebuffer = make_texture_framebuffer(target.texture);
+    }
+    else if (target.resized)
+    {
+        // Attaching the texture again makes this context pick up the
+        // storage the render thread allocated.
+        glBindFramebuffer(GL_FRAMEBUFFER, target.present_framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                               GL_TEXTURE_2D, target.texture, 0);
+    }
+    target.resized = false;
+
+    auto same_size = target.width == window_width_
+                     && target.height == window_height_;
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, target.present_framebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, target.width, target.height,
+                      0, 0, window_width_, window_height_,
+                      GL_COLOR_BUFFER_BIT, same_size ? GL_NEAREST : GL_LINEAR);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    if (target.presented)
+        glDeleteSync(target.presented);
+    target.presented = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+}
+
+void RenderThread::run()
+{
+    try
+    {
+        setup_render_context();
+        while (true)
+        {
+            {
+                std::unique_lock lock(wake_mutex_);
+                wake_.wait(lock, [this]
+                {
+                    return snapshot_pending_ || stop_;
+                });
+                if (stop_)
+                    break;
+                snapshot_pending_ = false;
+            }
+
+            if (snapshots_.update())
+                render(snapshots_.front());
+        }
+    }
+    catch (std::exception&)
+    {
+        error_ = std::current_exception();
+        failed_ = true;
+    }
+    release_render_context();
+}
+
+void RenderThread::setup_render_context()
+{
+    if (SDL_GL_MakeCurrent(window_, render_context_) != 0)
+        throw std::runtime_error(std::string("RenderThread: ")
+                                 + SDL_GetError());
+
+    glGenFramebuffers(1, &multisample_framebuffer_);
+    glBindFramebuffer(GL_FRAMEBUFFER, multisample_framebuffer_);
+    glGenRenderbuffers(2, multisample_renderbuffers_);
+    resize_multisample_buffers(width_, height_);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_RENDERBUFFER, multisample_renderbuffers_[0]);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                              GL_RENDERBUFFER, multisample_renderbuffers_[1]);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        throw std::runtime_error("RenderThread: incomplete framebuffer.");
+
+    glEnable(GL_DEPTH_TEST);
+
+    renderer_ = std::make_unique<MeshRenderer>();
+    renderer_->setup(proj_matrix_, *mesh_, topology_, flat_shading_,
+                     optimization_);
+    reporter_ = std::make_unique<GlStatsReporter>();
+    reporter_->setup(gl_stats_file_);
+    gpu_timer_ = std::make_unique<GpuTimer>(gpu_nanoseconds_);
+}
+
+void RenderThread::render(const FrameSnapshot& snapshot)
+{
+    if (snapshot.width != width_ || snapshot.height != height_)
+        resize_multisample_buffers(snapshot.width, snapshot.height);
+
+    auto& target = targets_.back();
+    wait_and_delete(target.presented);
+    if (target.width != width_ || target.height != height_)
+        resize_target(target);
+    // The main thread skipped this frame.
+    if (target.rendered)
+    {
+        glDeleteSync(target.rendered);
+        target.rendered = nullptr;
+    }
+    if (!target.render_framebuffer)
+        target.render_framebuffer = make_texture_framebuffer(target.texture);
+
+    {
+        GpuTimerScope gpu_timer_scope(*gpu_timer_);
+        glBindFramebuffer(GL_FRAMEBUFFER, multisample_framebuffer_);
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        if (snapshot.wireframe != wireframe_)
+        {
+            wireframe_ = snapshot.wireframe;
+            GlStats::polygon_mode(GL_FRONT_AND_BACK,
+                                  wireframe_ ? GL_LINE : GL_FILL);
+        }
+
+        if (snapshot.mesh && snapshot.mesh != mesh_)
+        {
+            mesh_ = snapshot.mesh;
+            topology_ = snapshot.topology;
+            renderer_->set_mesh(*mesh_, topology_);
+        }
+
+        renderer_->draw(snapshot.model_matrix);
+        reporter_->report(snapshot.show_gl_stats);
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, multisample_framebuffer_);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target.render_framebuffer);
+        glBlitFramebuffer(0, 0, width_, height_, 0, 0, width_, height_,
+                          GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    }
+
+    target.rendered = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    target.has_frame = true;
+    targets_.publish();
+}
+
+void RenderThread::resize_multisample_buffers(GLsizei width, GLsizei height)
+{
+    width_ = width;
+    height_ = height;
+    glBindRenderbuffer(GL_RENDERBUFFER, multisample_renderbuffers_[0]);
+    glRenderbufferStorageMultisample(GL_RENDERBUFFER, MULTI_SAMPLES,
+                                     GL_RGBA8, width_, height_);
+    glBindRenderbuffer(GL_RENDERBUFFER, multisample_renderbuffers_[1]);
+    glRenderbufferStorageMultisample(GL_RENDERBUFFER, MULTI_SAMPLES,
+                                     GL_DEPTH_COMPONENT24, width_, height_);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    glViewport(0, 0, width_, height_);
+}
+
+void RenderThread::resize_target(RenderTarget& target)
+{
+    glBindTexture(GL_TEXTURE_2D, target.texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width_, height_, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    target.width = width_;
+    target.height = height_;
+    target.resized = true;
+}
+
+void RenderThread::release_render_context()
+{
+    renderer_.reset();
+    reporter_.reset();
+    gpu_timer_.reset();
+    mesh_.reset();
+    if (multisample_framebuffer_)
+    {
+        glDeleteFramebuffers(1, &multisample_framebuffer_);
+        glDeleteRenderbuffers(2, multisample_renderbuffers_);
+        multisample_framebuffer_ = 0;
+    }
+    SDL_GL_MakeCurrent(window_, nullptr);
+}
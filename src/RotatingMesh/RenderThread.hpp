@@ -0,0 +1,177 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "GlStatsReporter.hpp"
+#include "GpuTimer.hpp"
+#include "MeshRenderer.hpp"
+#include "TripleBuffer.hpp"
+
+/**
+ * @brief Everything the render thread needs to draw a frame.
+ */
+struct FrameSnapshot
+{
+    /// A new pointer means the mesh has changed.
+    std::shared_ptr<const Xyz::Mesh<float>> mesh;
+    /// The mesh's topology key, see MeshRenderer.
+    uint64_t topology = 0;
+    Xyz::Matrix4F model_matrix;
+    bool wireframe = false;
+    bool show_gl_stats = false;
+    /// The size of the window's drawable, set by publish().
+    GLsizei width = 0;
+    GLsizei height = 0;
+};
+
+/**
+ * @brief Draws frame snapshots published by the main thread on a
+ *  separate thread with its own GL context.
+ *
+ * SdlApplication swaps the window's buffers on the main thread, so
+ * the render thread can't draw to the window directly. Instead it
+ * draws to textures that are shared with the main thread's context,
+ * and present() copies the most recent one to the window. Snapshots
+ * and finished frames are passed between the threads with triple
+ * buffers. GL fences make sure neither context touches a texture
+ * before the other one is done with it. The render thread sleeps on a
+ * condition variable until publish() or stop() wakes it.
+ */
+class RenderThread
+{
+public:
+    /**
+     * @param gpu_nanoseconds The GPU time spent drawing frames is
+     *  added to this counter.
+     */
+    RenderThread(bool flat_shading, MeshOptimization optimization,
+                 std::string gl_stats_file,
+                 std::atomic<uint64_t>& gpu_nanoseconds);
+
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /**
+     * @brief Creates the render thread's GL context and starts the
+     *  thread.
+     *
+     * Must be called on the main thread while the window's context is
+     * current. @a mesh must be at least as large as any later mesh.
+     */
+    void start(const Xyz::Matrix4F& proj_matrix,
+               std::shared_ptr<const Xyz::Mesh<float>> mesh,
+               uint64_t topology);
+
+    /**
+     * @brief Stops the thread and releases its GL resources.
+     *
+     * Must be called on the main thread.
+     */
+    void stop();
+
+    /**
+     * @brief The snapshot the main thread fills in before publish().
+     */
+    FrameSnapshot& snapshot();
+
+    void publish();
+
+    /**
+     * @brief Reads the current size of the window's drawable.
+     *
+     * Call this on the main thread when the window has been resized.
+     * The render thread resizes its buffers when it gets the next
+     * snapshot. Until then, present() scales the old frames to fit
+     * the window.
+     */
+    void update_size();
+
+    /**
+     * @brief Draws the most recently finished frame to the window.
+     *
+     * @throw Any exception that stopped the render thread.
+     */
+    void present();
+private:
+    struct RenderTarget
+    {
+        GLuint texture = 0;
+        /// Framebuffer in the render thread's context.
+        GLuint render_framebuffer = 0;
+        /// Framebuffer in the main thread's context.
+        GLuint present_framebuffer = 0;
+        /// Signaled when the render thread has finished the frame.
+        GLsync rendered = nullptr;
+        /// Signaled when the main thread has finished copying the frame.
+        GLsync presented = nullptr;
+        bool has_frame = false;
+        GLsizei width = 0;
+        GLsizei height = 0;
+        /// Set when the render thread has reallocated the texture, the
+        /// main thread must then attach it to present_framebuffer again.
+        bool resized = false;
+    };
+
+    void run();
+
+    void setup_render_context();
+
+    void render(const FrameSnapshot& snapshot);
+
+    void resize_multisample_buffers(GLsizei width, GLsizei height);
+
+    void resize_target(RenderTarget& target);
+
+    void release_render_context();
+
+    static constexpr GLsizei MULTI_SAMPLES = 2;
+
+    bool flat_shading_;
+    MeshOptimization optimization_;
+    std::string gl_stats_file_;
+    std::atomic<uint64_t>& gpu_nanoseconds_;
+    Xyz::Matrix4F proj_matrix_;
+    std::shared_ptr<const Xyz::Mesh<float>> mesh_;
+    uint64_t topology_ = 0;
+
+    SDL_Window* window_ = nullptr;
+    SDL_GLContext render_context_ = nullptr;
+    /// Only used by the main thread after start().
+    GLsizei window_width_ = 0;
+    GLsizei window_height_ = 0;
+
+    TripleBuffer<FrameSnapshot> snapshots_;
+    TripleBuffer<RenderTarget> targets_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    /// Guarded by wake_mutex_.
+    bool snapshot_pending_ = false;
+    /// Guarded by wake_mutex_.
+    bool stop_ = false;
+    std::atomic<bool> failed_ = false;
+    std::exception_ptr error_;
+    std::thread thread_;
+
+    // Only used by the render thread.
+    std::unique_ptr<MeshRenderer> renderer_;
+    std::unique_ptr<GlStatsReporter> reporter_;
+    std::unique_ptr<GpuTimer> gpu_timer_;
+    bool wireframe_ = false;
+    GLsizei width_ = 0;
+    GLsizei height_ = 0;
+    GLuint multisample_framebuffer_ = 0;
+    GLuint multisample_renderbuffers_[2] = {};
+};
@@ -0,0 +1,44 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#version 410
+
+layout (location = 0) in vec3 a_position;
+layout (location = 1) in vec3 a_normal;
+layout (location = 2) in float a_object_index;
+
+// Four RGBA texels per object, each texel is one row of the object's
+// model-view matrix.
+uniform samplerBuffer u_transforms;
+uniform mat4 u_proj_matrix;
+
+uniform vec3 u_light_pos = vec3(-100.0, -100.0, 100.0);
+
+out VS_OUT
+{
+    vec3 normal;
+    vec3 light;
+    vec3 view;
+} vs_out;
+
+mat4 get_mv_matrix(int index)
+{
+    return transpose(mat4(texelFetch(u_transforms, index * 4),
+                          texelFetch(u_transforms, index * 4 + 1),
+                          texelFetch(u_transforms, index * 4 + 2),
+                          texelFetch(u_transforms, index * 4 + 3)));
+}
+
+void main()
+{
+    mat4 mv_matrix = get_mv_matrix(int(a_object_index));
+    vec4 p = mv_matrix * vec4(a_position, 1.0);
+    vs_out.normal = mat3(mv_matrix) * a_normal;
+    vs_out.light = u_light_pos - p.xyz;
+    vs_out.view = -p.xyz;
+    gl_Position = u_proj_matrix * p;
+}
@@ -0,0 +1,46 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "SceneShaderProgram.hpp"
+
+#include "Scene-vert.glsl.hpp"
+
+template <typename Variant>
+void SceneShaderProgram<Variant>::setup()
+{
+    program = Tungsten::create_program();
+    auto vertexShader = Tungsten::create_shader(GL_VERTEX_SHADER,
+                                                Scene_vert);
+    Tungsten::attach_shader(program, vertexShader);
+
+    auto fragmentShader = Tungsten::create_shader(
+        GL_FRAGMENT_SHADER, Variant::phong_fragment_shader());
+    Tungsten::attach_shader(program, fragmentShader);
+    Tungsten::link_program(program);
+    Tungsten::use_program(program);
+
+    position_attr = Tungsten::get_vertex_attribute(program, "a_position");
+    normal_attr = Tungsten::get_vertex_attribute(program, "a_normal");
+    object_index_attr = Tungsten::get_vertex_attribute(program, "a_object_index");
+
+    transforms = Tungsten::get_uniform<GLint>(program, "u_transforms");
+    proj_matrix = Tungsten::get_uniform<Xyz::Matrix4F>(program, "u_proj_matrix");
+
+    light_pos = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_light_pos");
+    if constexpr (!Variant::FIXED_MATERIAL)
+    {
+        diffuse_albedo = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_diffuse_albedo");
+        specular_albedo = Tungsten::get_uniform<Xyz::Vector3F>(program, "u_specular_albedo");
+    }
+    if constexpr (!Variant::FIXED_SPECULAR_POWER)
+        specular_power = Tungsten::get_uniform<float>(program, "u_specular_power");
+}
+
+template class SceneShaderProgram<ShaderVariant::Dynamic>;
+template class SceneShaderProgram<ShaderVariant::FixedSpecularPower>;
+template class SceneShaderProgram<ShaderVariant::FixedMaterial>;
+template class SceneShaderProgram<ShaderVariant::Diffuse>;
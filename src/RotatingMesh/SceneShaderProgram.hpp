@@ -0,0 +1,34 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <Tungsten/Tungsten.hpp>
+#include "ShaderVariant.hpp"
+
+/**
+ * @brief Phong shading of the objects in a MeshBatch.
+ */
+template <typename Variant>
+class SceneShaderProgram
+{
+public:
+    void setup();
+
+    Tungsten::ProgramHandle program;
+
+    Tungsten::Uniform<GLint> transforms;
+    Tungsten::Uniform<Xyz::Matrix4F> proj_matrix;
+
+    Tungsten::Uniform<Xyz::Vector3F> light_pos;
+    ShaderVariant::Uniform<!Variant::FIXED_MATERIAL, Xyz::Vector3F> diffuse_albedo;
+    ShaderVariant::Uniform<!Variant::FIXED_MATERIAL, Xyz::Vector3F> specular_albedo;
+    ShaderVariant::Uniform<!Variant::FIXED_SPECULAR_POWER, float> specular_power;
+
+    GLuint position_attr;
+    GLuint normal_attr;
+    GLuint object_index_attr;
+};
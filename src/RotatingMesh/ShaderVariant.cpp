@@ -0,0 +1,60 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "ShaderVariant.hpp"
+
+#include "FlatPhong-frag.glsl.hpp"
+#include "FlatPhongDiffuse-frag.glsl.hpp"
+#include "FlatPhongFixedMaterial-frag.glsl.hpp"
+#include "FlatPhongFixedSpecularPower-frag.glsl.hpp"
+#include "Phong-frag.glsl.hpp"
+#include "PhongDiffuse-frag.glsl.hpp"
+#include "PhongFixedMaterial-frag.glsl.hpp"
+#include "PhongFixedSpecularPower-frag.glsl.hpp"
+
+namespace ShaderVariant
+{
+    const char* Dynamic::phong_fragment_shader()
+    {
+        return Phong_frag;
+    }
+
+    const char* Dynamic::flat_phong_fragment_shader()
+    {
+        return FlatPhong_frag;
+    }
+
+    const char* FixedSpecularPower::phong_fragment_shader()
+    {
+        return PhongFixedSpecularPower_frag;
+    }
+
+    const char* FixedSpecularPower::flat_phong_fragment_shader()
+    {
+        return FlatPhongFixedSpecularPower_frag;
+    }
+
+    const char* FixedMaterial::phong_fragment_shader()
+    {
+        return PhongFixedMaterial_frag;
+    }
+
+    const char* FixedMaterial::flat_phong_fragment_shader()
+    {
+        return FlatPhongFixedMaterial_frag;
+    }
+
+    const char* Diffuse::phong_fragment_shader()
+    {
+        return PhongDiffuse_frag;
+    }
+
+    const char* Diffuse::flat_phong_fragment_shader()
+    {
+        return FlatPhongDiffuse_frag;
+    }
+}
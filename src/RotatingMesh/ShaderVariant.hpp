@@ -0,0 +1,87 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <type_traits>
+#include <Tungsten/Tungsten.hpp>
+
+/**
+ * @brief Compile-time variants of the Phong fragment shaders.
+ *
+ * Each variant corresponds to a set of #defines that CMakeLists.txt
+ * injects into copies of Phong-frag.glsl and FlatPhong-frag.glsl.
+ * The material parameters a variant fixes are constants in its
+ * shader, and the program classes don't have uniforms for them.
+ * ShaderVariant.cpp maps each variant to its embedded shader sources.
+ */
+namespace ShaderVariant
+{
+    /// All material parameters are uniforms.
+    struct Dynamic
+    {
+        static constexpr bool FIXED_MATERIAL = false;
+        static constexpr bool FIXED_SPECULAR_POWER = false;
+        static constexpr bool NO_SPECULAR = false;
+
+        static const char* phong_fragment_shader();
+
+        static const char* flat_phong_fragment_shader();
+    };
+
+    /// The specular exponent is a constant.
+    struct FixedSpecularPower
+    {
+        static constexpr bool FIXED_MATERIAL = false;
+        static constexpr bool FIXED_SPECULAR_POWER = true;
+        static constexpr bool NO_SPECULAR = false;
+
+        static const char* phong_fragment_shader();
+
+        static const char* flat_phong_fragment_shader();
+    };
+
+    /// The albedos and the specular exponent are constants.
+    struct FixedMaterial
+    {
+        static constexpr bool FIXED_MATERIAL = true;
+        static constexpr bool FIXED_SPECULAR_POWER = true;
+        static constexpr bool NO_SPECULAR = false;
+
+        static const char* phong_fragment_shader();
+
+        static const char* flat_phong_fragment_shader();
+    };
+
+    /// Diffuse lighting only, with a constant albedo.
+    struct Diffuse
+    {
+        static constexpr bool FIXED_MATERIAL = true;
+        static constexpr bool FIXED_SPECULAR_POWER = true;
+        static constexpr bool NO_SPECULAR = true;
+
+        static const char* phong_fragment_shader();
+
+        static const char* flat_phong_fragment_shader();
+    };
+
+    /**
+     * @brief Takes the place of a uniform that a variant has made a
+     *  constant.
+     *
+     * It has no set(), so code that tries to change the constant
+     * doesn't compile.
+     */
+    struct NoUniform
+    {};
+
+    template <bool Exists, typename T>
+    using Uniform = std::conditional_t<Exists, Tungsten::Uniform<T>, NoUniform>;
+
+    /// The variant MeshRenderer and PrismScene draw with. Nothing
+    /// changes the material at runtime.
+    using Active = FixedMaterial;
+}
@@ -0,0 +1,17 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#version 410
+
+layout (location = 0) out vec4 color;
+
+uniform vec4 u_color = vec4(1.0, 1.0, 0.4, 1.0);
+
+void main()
+{
+    color = u_color;
+}
@@ -0,0 +1,19 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#version 410
+
+layout (location = 0) in vec2 a_position;
+
+// Maps pixel coordinates with the origin in the upper left corner
+// to normalized device coordinates.
+uniform vec2 u_scale;
+
+void main()
+{
+    gl_Position = vec4(a_position * u_scale + vec2(-1.0, 1.0), 0.0, 1.0);
+}
@@ -0,0 +1,174 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "TextOverlay.hpp"
+
+#include <cctype>
+
+namespace
+{
+    constexpr int GLYPH_WIDTH = 3;
+    constexpr int GLYPH_HEIGHT = 5;
+    constexpr float PIXEL_SIZE = 2;
+    constexpr float MARGIN = 8;
+
+    // Each glyph is GLYPH_HEIGHT rows of GLYPH_WIDTH pixels, top row first.
+    const char* get_glyph(char c)
+    {
+        switch (toupper(static_cast<unsigned char>(c)))
+        {
+        case '0': return "111101101101111";
+        case '1': return "010110010010111";
+        case '2': return "111001111100111";
+        case '3': return "111001111001111";
+        case '4': return "101101111001001";
+        case '5': return "111100111001111";
+        case '6': return "111100111101111";
+        case '7': return "111001001010010";
+        case '8': return "111101111101111";
+        case '9': return "111101111001111";
+        case 'A': return "010101111101101";
+        case 'B': return "110101110101110";
+        case 'C': return "011100100100011";
+        case 'D': return "110101101101110";
+        case 'E': return "111100110100111";
+        case 'F': return "111100110100100";
+        case 'G': return "011100101101011";
+        case 'H': return "101101111101101";
+        case 'I': return "111010010010111";
+        case 'J': return "001001001101010";
+        case 'K': return "101101110101101";
+        case 'L': return "100100100100111";
+        case 'M': return "101111111101101";
+        case 'N': return "110101101101101";
+        case 'O': return "010101101101010";
+        case 'P': return "110101110100100";
+        case 'Q': return "010101101110011";
+        case 'R': return "110101110101101";
+        case 'S': return "011100010001110";
+        case 'T': return "111010010010010";
+        case 'U': return "101101101101111";
+        case 'V': return "101101101101010";
+        case 'W': return "101101111111101";
+        case 'X': return "101101010101101";
+        case 'Y': return "101101010010010";
+        case 'Z': return "111001010100111";
+        case '.': return "000000000000010";
+        case ',': return "000000000010100";
+        case ':': return "000010000010000";
+        case '/': return "001001010100100";
+        case '-': return "000000111000000";
+        case '%': return "101001010100101";
+        case '=': return "000111000111000";
+        case '(': return "001010010010001";
+        case ')': return "100010010010100";
+        default: return nullptr;
+        }
+    }
+
+    void add_pixel(std::vector<Xyz::Vector2F>& vertexes, float x, float y)
+    {
+        Xyz::Vector2F p0 = {x, y};
+        Xyz::Vector2F p1 = {x + PIXEL_SIZE, y};
+        Xyz::Vector2F p2 = {x, y + PIXEL_SIZE};
+        Xyz::Vector2F p3 = {x + PIXEL_SIZE, y + PIXEL_SIZE};
+        vertexes.insert(vertexes.end(), {p0, p2, p1, p1, p2, p3});
+    }
+
+    std::vector<Xyz::Vector2F> make_text_vertexes(const std::string& text)
+    {
+        std::vector<Xyz::Vector2F> result;
+        float x = MARGIN;
+        float y = MARGIN;
+        for (char c : text)
+        {
+            if (c == '\n')
+            {
+                x = MARGIN;
+                y += (GLYPH_HEIGHT + 2) * PIXEL_SIZE;
+                continue;
+            }
+
+            if (auto glyph = get_glyph(c))
+            {
+                for (int i = 0; i < GLYPH_WIDTH * GLYPH_HEIGHT; ++i)
+                {
+                    if (glyph[i] == '1')
+                    {
+                        add_pixel(result,
+                                  x + float(i % GLYPH_WIDTH) * PIXEL_SIZE,
+                                  y + float(i / GLYPH_WIDTH) * PIXEL_SIZE);
+                    }
+                }
+            }
+            x += (GLYPH_WIDTH + 1) * PIXEL_SIZE;
+        }
+        return result;
+    }
+}
+
+void TextOverlay::setup()
+{
+    GLint prev_program, prev_vertex_array, prev_buffer;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &prev_program);
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &prev_vertex_array);
+    glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &prev_buffer);
+
+    program_.setup();
+    vertex_array_ = Tungsten::generate_vertex_array();
+    Tungsten::bind_vertex_array(vertex_array_);
+    buffers_ = Tungsten::generate_buffers(1);
+    glBindBuffer(GL_ARRAY_BUFFER, buffers_[0].get());
+    Tungsten::enable_vertex_attribute(program_.position_attr);
+    Tungsten::define_vertex_attribute_pointer(program_.position_attr, 2,
+                                              GL_FLOAT, false,
+                                              sizeof(Xyz::Vector2F), 0);
+
+    glBindVertexArray(GLuint(prev_vertex_array));
+    glBindBuffer(GL_ARRAY_BUFFER, GLuint(prev_buffer));
+    glUseProgram(GLuint(prev_program));
+}
+
+void TextOverlay::set_text(const std::string& text)
+{
+    auto vertexes = make_text_vertexes(text);
+    GLint prev_buffer;
+    glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &prev_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffers_[0].get());
+    glBufferData(GL_ARRAY_BUFFER,
+                 GLsizeiptr(vertexes.size() * sizeof(Xyz::Vector2F)),
+                 vertexes.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, GLuint(prev_buffer));
+    vertex_count_ = GLsizei(vertexes.size());
+}
+
+void TextOverlay::draw()
+{
+    if (vertex_count_ == 0)
+        return;
+
+    GLint prev_program, prev_vertex_array, prev_polygon_mode[2], viewport[4];
+    glGetIntegerv(GL_CURRENT_PROGRAM, &prev_program);
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &prev_vertex_array);
+    glGetIntegerv(GL_POLYGON_MODE, prev_polygon_mode);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    auto depth_test = glIsEnabled(GL_DEPTH_TEST);
+
+    glDisable(GL_DEPTH_TEST);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    Tungsten::use_program(program_.program);
+    program_.scale.set({2.0f / float(viewport[2]), -2.0f / float(viewport[3])});
+    Tungsten::bind_vertex_array(vertex_array_);
+
+    glDrawArrays(GL_TRIANGLES, 0, vertex_count_);
+
+    glBindVertexArray(GLuint(prev_vertex_array));
+    glUseProgram(GLuint(prev_program));
+    glPolygonMode(GL_FRONT_AND_BACK, GLenum(prev_polygon_mode[0]));
+    if (depth_test)
+        glEnable(GL_DEPTH_TEST);
+}
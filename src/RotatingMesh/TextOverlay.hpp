@@ -0,0 +1,33 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <string>
+#include "TextOverlayShaderProgram.hpp"
+
+/**
+ * @brief Draws a few lines of text in the upper left corner of the
+ *  window with a built-in 3x5 pixel font.
+ *
+ * Letters are drawn in upper case, characters without a glyph are
+ * drawn as spaces. draw() restores the GL state it changes, so the
+ * overlay can be drawn at the end of any frame.
+ */
+class TextOverlay
+{
+public:
+    void setup();
+
+    void set_text(const std::string& text);
+
+    void draw();
+private:
+    TextOverlayShaderProgram program_;
+    Tungsten::VertexArrayHandle vertex_array_;
+    std::vector<Tungsten::BufferHandle> buffers_;
+    GLsizei vertex_count_ = 0;
+};
@@ -0,0 +1,30 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "TextOverlayShaderProgram.hpp"
+
+#include "TextOverlay-frag.glsl.hpp"
+#include "TextOverlay-vert.glsl.hpp"
+
+void TextOverlayShaderProgram::setup()
+{
+    program = Tungsten::create_program();
+    auto vertexShader = Tungsten::create_shader(GL_VERTEX_SHADER,
+                                                TextOverlay_vert);
+    Tungsten::attach_shader(program, vertexShader);
+
+    auto fragmentShader = Tungsten::create_shader(GL_FRAGMENT_SHADER,
+                                                  TextOverlay_frag);
+    Tungsten::attach_shader(program, fragmentShader);
+    Tungsten::link_program(program);
+    Tungsten::use_program(program);
+
+    position_attr = Tungsten::get_vertex_attribute(program, "a_position");
+
+    scale = Tungsten::get_uniform<Xyz::Vector2F>(program, "u_scale");
+    color = Tungsten::get_uniform<Xyz::Vector4F>(program, "u_color");
+}
@@ -0,0 +1,22 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <Tungsten/Tungsten.hpp>
+
+class TextOverlayShaderProgram
+{
+public:
+    void setup();
+
+    Tungsten::ProgramHandle program;
+
+    Tungsten::Uniform<Xyz::Vector2F> scale;
+    Tungsten::Uniform<Xyz::Vector4F> color;
+
+    GLuint position_attr;
+};
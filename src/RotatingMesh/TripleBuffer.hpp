@@ -0,0 +1,88 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Passes values from one writer thread to one reader thread
+ *  without locks.
+ *
+ * The writer fills in back() and calls publish(), the reader calls
+ * update() and reads front(). The reader always gets the most recently
+ * published value, values that are published faster than the reader
+ * updates are skipped. Each thread has exclusive access to its slot
+ * until it calls publish() or update().
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    /**
+     * @brief The writer's slot.
+     */
+    T& back()
+    {
+        return slots_[back_];
+    }
+
+    /**
+     * @brief Makes back() available to the reader and gives the
+     *  writer a new slot.
+     *
+     * The new back() still contains whatever was written to it the
+     * last time it was used.
+     */
+    void publish()
+    {
+        auto prev = middle_.exchange(uint8_t(back_ | NEW_VALUE),
+                                     std::memory_order_acq_rel);
+        back_ = uint8_t(prev & INDEX_MASK);
+    }
+
+    /**
+     * @brief Replaces front() with the most recently published value.
+     *
+     * @return false if nothing has been published since the last call,
+     *  front() is then unchanged.
+     */
+    bool update()
+    {
+        if (!(middle_.load(std::memory_order_acquire) & NEW_VALUE))
+            return false;
+        auto prev = middle_.exchange(front_, std::memory_order_acq_rel);
+        front_ = uint8_t(prev & INDEX_MASK);
+        return true;
+    }
+
+    /**
+     * @brief The reader's slot.
+     */
+    T& front()
+    {
+        return slots_[front_];
+    }
+
+    /**
+     * @brief Gives access to all slots while no other thread uses
+     *  the buffer, e.g. to initialize or clean up the slots.
+     */
+    std::array<T, 3>& slots()
+    {
+        return slots_;
+    }
+private:
+    static constexpr uint8_t INDEX_MASK = 3;
+    static constexpr uint8_t NEW_VALUE = 4;
+
+    std::array<T, 3> slots_ = {};
+    uint8_t front_ = 0;
+    std::atomic<uint8_t> middle_ = 1;
+    uint8_t back_ = 2;
+};
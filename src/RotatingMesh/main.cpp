@@ -1,96 +1,16 @@
 #include <iostream>
 #include <Tungsten/Tungsten.hpp>
-#include "PhongShaderProgram.hpp"
-
-struct Point
-{
-    Xyz::Vector3F coords;
-    Xyz::Vector3F normal;
-};
-
-std::vector<Xyz::Vector2F> make_polygon(unsigned n)
-{
-    constexpr auto PI = Xyz::Constants<float>::PI;
-    std::vector<Xyz::Vector2F> result;
-    auto angle0 = 1.5f * PI - PI / float(n);
-    for (unsigned i = 0; i < n; ++i)
-    {
-        auto angle = angle0 + float(i) * 2 * PI / float(n);
-        result.push_back({cos(angle), sin(angle)});
-    }
-    return result;
-}
-
-std::vector<Xyz::Vector2F> make_transition_polygon(unsigned n, float fraction)
-{
-    if (fraction <= 0)
-        return make_polygon(n);
-    if (fraction >= 1)
-        return make_polygon(n + 1);
-    const auto points0 = make_polygon(n);
-    const auto points1 = make_polygon(n + 1);
-    std::vector<Xyz::Vector2F> result;
-    for (unsigned i = 0; i < n; ++i)
-        result.push_back(points0[i] + (points1[i] - points0[i]) * fraction);
-    result.push_back(points0[0] + (points1.back() - points0[0]) * fraction);
-    return result;
-}
-
-Xyz::Mesh<float> make_polygon_mesh(unsigned n, float fraction)
-{
-    const auto RADIUS = sqrt(2.0f);
-    auto points = make_transition_polygon(n, fraction);
-    Xyz::Mesh<float> mesh;
-    for (auto p : points)
-    {
-        p *= RADIUS;
-        mesh.add_vertex({p[0], p[1], -1});
-        mesh.add_vertex({p[0], p[1], 1});
-    }
-    if (fraction > 0)
-        n += 1;
-    for (unsigned i = 0; i < n - 1; ++i)
-    {
-        auto j = i * 2;
-        mesh.add_face({j, j + 2, j + 1});
-        mesh.add_face({j + 2, j + 3, j + 1});
-    }
-    auto bottom_center = uint32_t(mesh.vertexes().size());
-    mesh.add_vertex({0, 0, -1});
-    auto top_center = uint32_t(mesh.vertexes().size());
-    mesh.add_vertex({0, 0, 1});
-    mesh.add_face({2 * n - 2, 0, 2 * n - 1});
-    mesh.add_face({0, 1, 2 * n - 1});
-    for (unsigned i = 0; i < n - 1; ++i)
-    {
-        auto j = i * 2;
-        mesh.add_face({j + 1, j + 3, top_center});
-        mesh.add_face({j + 2, j, bottom_center});
-    }
-
-    mesh.add_face({2 * n - 1, 1, top_center});
-    mesh.add_face({0, 2 * n - 2, bottom_center});
-
-    return mesh;
-}
-
-void add_mesh(Tungsten::ArrayBuffer<Point>& buffer,
-              Xyz::Mesh<float>& mesh)
-{
-    Tungsten::ArrayBufferBuilder builder(buffer);
-    builder.reserve_vertexes(mesh.faces().size() * 3);
-    builder.reserve_indexes(mesh.faces().size() * 3);
-    int n = 0;
-    for (const auto& face : mesh.faces())
-    {
-        auto normal = mesh.normal(face);
-        builder.add_vertex({mesh.vertexes()[face[0]], normal});
-        builder.add_vertex({mesh.vertexes()[face[1]], normal});
-        builder.add_vertex({mesh.vertexes()[face[2]], normal});
-        builder.add_indexes(n, n + 1, n + 2);
-        n += 3;
-    }
-}
+#include "FrameScheduler.hpp"
+#include "FrameTimes.hpp"
+#include "GlStats.hpp"
+#include "GlStatsReporter.hpp"
+#include "GpuTimer.hpp"
+#include "InputRecording.hpp"
+#include "MeshRenderer.hpp"
+#include "Options.hpp"
+#include "PolygonMesh.hpp"
+#include "PrismScene.hpp"
+#include "RenderThread.hpp"
 
 struct Foo
 {
@@ -112,49 +32,215 @@ struct Foo
 class RotatingMeshLoop : public Tungsten::EventLoop
 {
 public:
+    explicit RotatingMeshLoop(RotatingMeshOptions options)
+        : options_(std::move(options)),
+          show_gl_stats_(options_.show_gl_stats),
+          scheduler_({unsigned(options_.unfocused_fps),
+                      unsigned(options_.max_fps),
+                      options_.power_stats})
+    {}
+
     void on_startup(Tungsten::SdlApplication& app) override
     {
-        mesh_ = make_polygon_mesh(10, 0);
-        Tungsten::ArrayBuffer<Point> buffer;
-        add_mesh(buffer, mesh_);
-
-        vertex_array_ = Tungsten::generate_vertex_array();
-        Tungsten::bind_vertex_array(vertex_array_);
-
-        buffers_ = Tungsten::generate_buffers(2);
-        Tungsten::set_buffers(buffers_[0], buffers_[1], buffer,
-                              GL_DYNAMIC_DRAW);
-        element_count_ = GLsizei(buffer.indexes.size());
-        program_.setup();
-
-        GLsizei row_size = sizeof(Point);
-        Tungsten::enable_vertex_attribute(program_.position_attr);
-        Tungsten::define_vertex_attribute_pointer(program_.position_attr, 3,
-                                                  GL_FLOAT, false, row_size, 0);
-        Tungsten::enable_vertex_attribute(program_.normal_attr);
-        Tungsten::define_vertex_attribute_pointer(program_.normal_attr, 3,
-                                                  GL_FLOAT, false, row_size, 3 * sizeof(GLfloat));
-
         auto proj_mat = Xyz::scale4<float>(1.0f, app.aspect_ratio(), 1.0f)
                         * Xyz::make_frustum_matrix<float>(-2, 2, -2, 2, 2, 20)
                         * Xyz::make_look_at_matrix(Xyz::make_vector3<float>(-4, -4, 2.5),
                                                    Xyz::make_vector3<float>(0, 0, 0),
                                                    Xyz::make_vector3<float>(0, 0, 1));
-        program_.proj_matrix.set(proj_mat);
+        if (options_.scene_size != 0)
+        {
+            scene_ = std::make_unique<PrismScene>(options_.scene_size);
+            scene_->setup(proj_mat);
+        }
+        else if (options_.render_thread)
+        {
+            mesh_ = std::make_shared<Xyz::Mesh<float>>(make_polygon_mesh(10, 0));
+            mesh_topology_ = polygon_mesh_topology(10, 0);
+            render_thread_ = std::make_unique<RenderThread>(
+                options_.flat_shading, options_.mesh_optimization,
+                options_.gl_stats_file,
+                scheduler_.gpu_nanoseconds());
+            render_thread_->start(proj_mat, mesh_, mesh_topology_);
+        }
+        else
+        {
+            mesh_ = std::make_shared<Xyz::Mesh<float>>(make_polygon_mesh(10, 0));
+            mesh_topology_ = polygon_mesh_topology(10, 0);
+            mesh_renderer_.setup(proj_mat, *mesh_, mesh_topology_,
+                                 options_.flat_shading,
+                                 options_.mesh_optimization);
+        }
 
-        app.set_swap_interval(1);
+        if (!render_thread_)
+            gl_stats_reporter_.setup(options_.gl_stats_file);
+
+        if (!options_.replay_file.empty())
+            player_ = std::make_unique<InputPlayer>(options_.replay_file);
+        else if (!options_.record_file.empty())
+            recorder_ = std::make_unique<InputRecorder>(options_.record_file);
+
+        if (player_)
+        {
+            gpu_timer_ = std::make_unique<GpuTimer>(
+                scheduler_.gpu_nanoseconds(),
+                [this](uint64_t ns)
+                {
+                    frame_times_.add_gpu_time(double(ns) * 1e-6);
+                });
+        }
+        else
+        {
+            gpu_timer_ = std::make_unique<GpuTimer>(scheduler_.gpu_nanoseconds());
+        }
+
+        // Replays measure how fast frames can be made, vsync would
+        // round every frame time up to the display's refresh interval.
+        app.set_swap_interval(player_ ? 0 : 1);
+        scheduler_.set_vsync(SDL_GL_GetSwapInterval() != 0);
         glEnable(GL_DEPTH_TEST);
     }
 
     bool on_event(Tungsten::SdlApplication& app, const SDL_Event& event) override
     {
+        // Stop the render thread while the window and its context
+        // still exist.
+        if (event.type == SDL_QUIT && render_thread_)
+            render_thread_->stop();
+
+        if (event.type == SDL_WINDOWEVENT)
+        {
+            scheduler_.handle_window_event(event.window);
+            if (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED
+                && render_thread_)
+            {
+                render_thread_->update_size();
+            }
+        }
+
         if (event.type != SDL_KEYDOWN && event.type != SDL_KEYUP)
             return false;
 
+        // The recording is the only source of key events during replay.
+        if (player_)
+            return true;
+
+        if (recorder_)
+            recorder_->record_key(event.key);
+
+        return handle_key_event(event);
+    }
+
+    void on_update(Tungsten::SdlApplication& app) override
+    {
+        // Replays run at full speed, whatever the window's state.
+        if (!player_)
+            scheduler_.begin_frame();
+
+        if (player_)
+        {
+            if (!player_->read_frame(ticks_, replay_events_))
+            {
+                finish_replay();
+                return;
+            }
+            for (const auto& event : replay_events_)
+                handle_key_event(event);
+            frame_times_.begin_frame();
+        }
+        else
+        {
+            ticks_ = SDL_GetTicks();
+            if (recorder_)
+                recorder_->record_frame(ticks_);
+            if (!scheduler_.is_visible())
+                return;
+        }
+
+        if (scene_)
+        {
+            scene_->update(ticks_);
+            return;
+        }
+
+        auto value = foo_.value(ticks_);
+        if (value != prev_value_)
+        {
+            float int_part;
+            float fraction = modf(value, &int_part);
+            mesh_ = std::make_shared<Xyz::Mesh<float>>(
+                make_polygon_mesh(unsigned(int_part), fraction));
+            mesh_topology_ = polygon_mesh_topology(unsigned(int_part), fraction);
+            prev_value_ = value;
+            update_buffer_ = true;
+        }
+
+        if (render_thread_)
+        {
+            auto& snapshot = render_thread_->snapshot();
+            snapshot.mesh = mesh_;
+            snapshot.topology = mesh_topology_;
+            snapshot.model_matrix = model_matrix();
+            snapshot.wireframe = draw_wireframe_;
+            snapshot.show_gl_stats = show_gl_stats_;
+            render_thread_->publish();
+        }
+    }
+
+    void on_draw(Tungsten::SdlApplication& app) override
+    {
+        if (!player_ && !scheduler_.is_visible())
+        {
+            scheduler_.end_frame(false);
+            return;
+        }
+
+        try
+        {
+            GpuTimerScope gpu_timer_scope(*gpu_timer_);
+            if (render_thread_)
+            {
+                render_thread_->present();
+            }
+            else
+            {
+                glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+                if (scene_)
+                    scene_->draw();
+                else
+                    draw_mesh();
+
+                gl_stats_reporter_.report(show_gl_stats_);
+            }
+        }
+        catch (Tungsten::TungstenException& ex)
+        {
+            std::cerr << ex.what() << "\n";
+        }
+        scheduler_.end_frame(true);
+        if (player_)
+            frame_times_.end_frame();
+    }
+
+private:
+    bool handle_key_event(const SDL_Event& event)
+    {
         if (event.type == SDL_KEYUP && event.key.keysym.sym == SDLK_p)
         {
             draw_wireframe_ = !draw_wireframe_;
-            glPolygonMode(GL_FRONT_AND_BACK, draw_wireframe_ ? GL_LINE : GL_FILL);
+            // The render thread sets the polygon mode itself.
+            if (!render_thread_)
+            {
+                GlStats::polygon_mode(GL_FRONT_AND_BACK,
+                                      draw_wireframe_ ? GL_LINE : GL_FILL);
+            }
+            return true;
+        }
+
+        if (event.type == SDL_KEYUP && event.key.keysym.sym == SDLK_s)
+        {
+            show_gl_stats_ = !show_gl_stats_;
             return true;
         }
 
@@ -179,73 +265,73 @@ public:
         return true;
     }
 
-    void on_update(Tungsten::SdlApplication& app) override
+    void finish_replay()
     {
-        auto value = foo_.value(SDL_GetTicks());
-        if (value == prev_value_)
-            return;
+        player_.reset();
+        std::cout << "Replayed " << options_.replay_file << ":\n";
+        frame_times_.write_report(std::cout);
 
-        float int_part;
-        float fraction = modf(value, &int_part);
-        mesh_ = make_polygon_mesh(unsigned(int_part), fraction);
-        update_buffer_ = true;
+        SDL_Event event = {};
+        event.type = SDL_QUIT;
+        SDL_PushEvent(&event);
     }
 
-    void on_draw(Tungsten::SdlApplication& app) override
+    [[nodiscard]]
+    Xyz::Matrix4F model_matrix() const
     {
-        try
-        {
-            if (update_buffer_)
-            {
-                Tungsten::ArrayBuffer<Point> buffer;
-                add_mesh(buffer, mesh_);
-
-                auto [v_buf, v_size] = buffer.array_buffer();
-                Tungsten::set_buffer_subdata(GL_ARRAY_BUFFER, 0,
-                                             GLsizeiptr(v_size), v_buf);
-                auto [i_buf, i_size] = buffer.index_buffer();
-                Tungsten::set_buffer_subdata(GL_ELEMENT_ARRAY_BUFFER, 0,
-                                             GLsizeiptr(i_size), i_buf);
-                element_count_ = GLsizei(buffer.indexes.size());
-                update_buffer_ = false;
-            }
-            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-            auto angle = Xyz::to_radians(float(SDL_GetTicks() / 50.0));
-            auto model_mat = Xyz::rotate_z(angle);
-            program_.mv_matrix.set(model_mat);
+        return Xyz::rotate_z(Xyz::to_radians(float(ticks_ / 50.0)));
+    }
 
-            glDrawElements(GL_TRIANGLES, element_count_, GL_UNSIGNED_SHORT, nullptr);
-        }
-        catch (Tungsten::TungstenException& ex)
+    void draw_mesh()
+    {
+        if (update_buffer_)
         {
-            std::cerr << ex.what() << "\n";
+            mesh_renderer_.set_mesh(*mesh_, mesh_topology_);
+            update_buffer_ = false;
         }
+
+        mesh_renderer_.draw(model_matrix());
     }
 
-private:
-    std::vector<Tungsten::BufferHandle> buffers_;
-    Tungsten::VertexArrayHandle vertex_array_;
-    PhongShaderProgram program_;
-    GLsizei element_count_ = 0;
-    Xyz::Mesh<float> mesh_;
+    RotatingMeshOptions options_;
+    MeshRenderer mesh_renderer_;
+    std::shared_ptr<const Xyz::Mesh<float>> mesh_;
+    uint64_t mesh_topology_ = 0;
     bool update_buffer_ = false;
     Foo foo_ = {0, 10, 3, 0};
     float prev_value_ = 10;
     bool draw_wireframe_ = false;
+    std::unique_ptr<PrismScene> scene_;
+    uint32_t ticks_ = 0;
+    std::unique_ptr<InputRecorder> recorder_;
+    std::unique_ptr<InputPlayer> player_;
+    std::vector<SDL_Event> replay_events_;
+    FrameTimes frame_times_;
+    bool show_gl_stats_ = false;
+    GlStatsReporter gl_stats_reporter_;
+    // Must outlive render_thread_ and gpu_timer_, which add to its
+    // GPU time counter.
+    FrameScheduler scheduler_;
+    std::unique_ptr<GpuTimer> gpu_timer_;
+    std::unique_ptr<RenderThread> render_thread_;
 };
 
 int main(int argc, char* argv[])
 {
     try
     {
+        auto options = extract_options(argc, argv);
         Tungsten::SdlApplication app("RotatingMesh",
-                                     std::make_unique<RotatingMeshLoop>());
+                                     std::make_unique<RotatingMeshLoop>(options));
         app.parse_command_line_options(argc, argv);
-        auto params = app.window_parameters();
-        params.gl_parameters.multi_sampling = {1, 2};
-        app.set_window_parameters(params);
+        // The render thread does its own multisampling, and the frames
+        // can't be copied to a multisampled window.
+        if (!options.render_thread)
+        {
+            auto params = app.window_parameters();
+            params.gl_parameters.multi_sampling = {1, 2};
+            app.set_window_parameters(params);
+        }
         app.run();
     }
     catch (std::exception& ex)